@@ -87,6 +87,14 @@ class JoystickReader {
       
       return MyTrig::magnitude(x, y);
     }
+    
+    // Angle and magnitude from a single reading and one CORDIC pass
+    MyTrig::Polar getPolar() {
+      int x = analogRead(xPin) - 512;
+      int y = analogRead(yPin) - 512;
+      
+      return MyTrig::to_polar(x, y);
+    }
 };
 
 // Distance sensor with angle
@@ -175,8 +183,9 @@ void setup() {
 
 void loop() {
   // Read joystick and move servo
-  uint16_t angle = joystick.getAngle();
-  int16_t magnitude = joystick.getMagnitude();
+  MyTrig::Polar stick = joystick.getPolar();
+  uint16_t angle = stick.angle;
+  int16_t magnitude = stick.magnitude;
   
   if (magnitude > 100) {  // Deadzone
     servo.setAngle(angle);
@@ -210,9 +219,9 @@ void testTrigFunctions() {
     
     Serial.print(deg);
     Serial.print("°    ");
-    Serial.print(s / 16384.0 * 2.0, 3);
+    Serial.print(s / 16384.0, 3);
     Serial.print("  ");
-    Serial.print(c / 16384.0 * 2.0, 3);
+    Serial.print(c / 16384.0, 3);
     
     if (deg % 180 != 90) {
       int16_t t = MyTrig::tan(angle);
@@ -1,9 +1,20 @@
 // examples.cpp - Example usage of the FastTrig library
 
 #include "fast_trig.hpp"
+#include "fast_trig_dsp.hpp"
+#include "fast_trig_motor.hpp"
+#include "fast_trig_robotics.hpp"
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 
 using namespace FastTrig;
 
@@ -12,6 +23,11 @@ class RobotNavigator {
     using Trig = Trig128;
     
 public:
+    // 0.0625 mm per encoder tick, wheels 250 mm apart
+    static constexpr Odometry<>::Length TICK_LENGTH = 0.0625;
+    static constexpr Odometry<>::Length TRACK_WIDTH = 250.0;
+    
+
     struct Position {
         int32_t x, y;  // millimeters
     };
@@ -34,24 +50,37 @@ public:
     }
     
     Position move(Position current, uint16_t heading, int32_t distance) {
-        int16_t cos_h = Trig::cos(heading);
-        int16_t sin_h = Trig::sin(heading);
+        int16_t cos_h, sin_h;
+        Trig::sincos(heading, sin_h, cos_h);
         
         return {
             current.x + (distance * cos_h) / 16384,
             current.y + (distance * sin_h) / 16384
         };
     }
+    
+    // Dead reckoning from per-sample wheel ticks; move() above truncates
+    // every step, so use it for one-off moves only
+    Position drive(std::span<const int32_t> left_ticks, std::span<const int32_t> right_ticks) {
+        odometry_.update(left_ticks, right_ticks);
+        return {static_cast<int32_t>(odometry_.x().to_int<RoundNearest>()),
+                static_cast<int32_t>(odometry_.y().to_int<RoundNearest>())};
+    }
+    
+    Angle32 heading() const { return odometry_.heading(); }
+    
+private:
+    Odometry<> odometry_{TICK_LENGTH, TRACK_WIDTH};
 };
 
 // Example 2: Servo control for robot arm
 class ServoController {
-    using Trig = Trig256;  // Higher precision for servo control
+    using Arm = Kinematics<Trig256>;  // Higher precision for servo control
     
 public:
     struct JointAngles {
         uint16_t shoulder;
-        uint16_t elbow;
+        uint16_t elbow;   // relative to the upper arm
         uint16_t wrist;
     };
     
@@ -59,33 +88,25 @@ public:
         int16_t x, y, z;  // Position in mm
     };
     
-    // Forward kinematics
-    EndEffector forward_kinematics(JointAngles angles, int16_t l1, int16_t l2) {
-        int16_t cos_s = Trig::cos(angles.shoulder);
-        int16_t sin_s = Trig::sin(angles.shoulder);
-        int16_t cos_e = Trig::cos(angles.elbow);
-        int16_t sin_e = Trig::sin(angles.elbow);
-        
-        int16_t x = (l1 * cos_s + l2 * cos_e) / 16384;
-        int16_t y = (l1 * sin_s + l2 * sin_e) / 16384;
-        
-        return {x, y, 0};
+    // Link lengths in mm
+    ServoController(int16_t upper, int16_t lower) : arm_(upper, lower) {}
+    
+    EndEffector forward_kinematics(JointAngles angles) const {
+        auto pose = arm_.forward({Angle14::from_raw(angles.shoulder), Angle14::from_raw(angles.elbow),
+                                  Angle14::from_raw(angles.wrist)});
+        return {static_cast<int16_t>(pose.position.x), static_cast<int16_t>(pose.position.y), 0};
     }
     
-    // Inverse kinematics (simplified 2D)
-    JointAngles inverse_kinematics(int16_t x, int16_t y, int16_t l1, int16_t l2) {
-        int32_t dist_sq = x*x + y*y;
-        int32_t dist = Trig::magnitude(x, y);
-        
-        // Calculate elbow angle using law of cosines
-        int32_t cos_elbow = (dist_sq - l1*l1 - l2*l2) / (2*l1*l2);
-        uint16_t elbow = Trig::acos((cos_elbow * 8192) / 16384);
-        
-        // Calculate shoulder angle
-        uint16_t shoulder = Trig::atan2(y, x);
-        
-        return {shoulder, elbow, 0};
+    // Targets out of reach leave the arm stretched or folded towards them
+    JointAngles inverse_kinematics(int16_t x, int16_t y) const {
+        auto joints = arm_.solve(Arm::Point{x, y});
+        return {joints.shoulder.raw(), joints.elbow.raw(), 0};
     }
+    
+    bool reachable(int16_t x, int16_t y) const { return arm_.reachable(Arm::Point{x, y}); }
+    
+private:
+    Arm arm_;
 };
 
 // Example 3: Signal processing
@@ -98,15 +119,15 @@ public:
         int16_t imag;
     };
     
-    // Rotate complex number by angle (for FFT, modulation, etc.)
-    Complex rotate_complex(Complex z, uint16_t angle) {
-        int16_t cos_a = Trig::cos(angle);
-        int16_t sin_a = Trig::sin(angle);
-        
-        return {
-            static_cast<int16_t>((z.real * cos_a - z.imag * sin_a) / 16384),
-            static_cast<int16_t>((z.real * sin_a + z.imag * cos_a) / 16384)
-        };
+    // Bring a carrier at frequency_hz down to 0 Hz
+    void tune(int32_t frequency_hz, uint32_t sample_rate_hz) {
+        mixer_.set_increment(Mixer<Trig>::increment_for(-frequency_hz, sample_rate_hz));
+    }
+    
+    // The mixer phase carries over from block to block, so a stream can
+    // arrive in any block sizes
+    void downconvert(std::span<const ComplexQ15> in, std::span<ComplexQ15> out) {
+        mixer_.mix(in, out);
     }
     
     // Generate sine wave samples
@@ -134,6 +155,9 @@ public:
             static_cast<int16_t>(imag_sum / N)
         };
     }
+    
+private:
+    Mixer<Trig> mixer_;
 };
 
 // Example 4: Game physics
@@ -171,31 +195,28 @@ public:
 class MotorController {
     using Trig = Trig128;
     
-    struct MotorVector {
-        int16_t d;  // Direct axis
-        int16_t q;  // Quadrature axis
-    };
-    
 public:
-    // Park transformation for FOC (Field Oriented Control)
-    MotorVector park_transform(int16_t alpha, int16_t beta, uint16_t theta) {
-        int16_t cos_theta = Trig::cos(theta);
-        int16_t sin_theta = Trig::sin(theta);
-        
-        return {
-            static_cast<int16_t>((alpha * cos_theta + beta * sin_theta) >> 14),
-            static_cast<int16_t>((-alpha * sin_theta + beta * cos_theta) >> 14)
-        };
+    // 20 kHz center-aligned PWM from a 160 MHz timer
+    static constexpr uint16_t PWM_PERIOD = 4000;
+    
+    // One current-loop step: measured phase currents in, timer compare
+    // values out. Clarke, Park, the d/q controllers, inverse Park and
+    // SVPWM share one sincos of the rotor angle.
+    PwmDuty step(PhaseCurrents measured, Angle14 rotor_angle, int16_t torque_current) {
+        auto cycle = foc_.run(measured, rotor_angle, [&](DQ current) {
+            return DQ{proportional(0, current.d), proportional(torque_current, current.q)};
+        });
+        return cycle.duty;
     }
     
-    // Inverse Park transformation
-    void inverse_park(MotorVector dq, uint16_t theta, int16_t& alpha, int16_t& beta) {
-        int16_t cos_theta = Trig::cos(theta);
-        int16_t sin_theta = Trig::sin(theta);
-        
-        alpha = (dq.d * cos_theta - dq.q * sin_theta) >> 14;
-        beta = (dq.d * sin_theta + dq.q * cos_theta) >> 14;
+private:
+    // Kp = 4, saturating to the linear SVPWM range
+    static int16_t proportional(int16_t target, int16_t measured) {
+        int32_t v = (int32_t(target) - measured) * 4;
+        return static_cast<int16_t>(std::clamp(v, int32_t(-23170), int32_t(23170)));
     }
+    
+    FOC<Trig> foc_{PWM_PERIOD};
 };
 
 // Performance benchmark function
@@ -228,17 +249,185 @@ void benchmark() {
               << iterations << " ops (" 
               << (duration.count() * 1000.0 / iterations) << " ns/op)\n";
     
-    // Benchmark atan2
+    // Benchmark sincos (one decode for both results)
+    int16_t sin_val, cos_val;
     start = std::chrono::high_resolution_clock::now();
     for (int i = 0; i < iterations; ++i) {
-        result = Trig128::atan2(i & 0x1FFF, (i >> 4) & 0x1FFF);
+        Trig128::sincos(i & 0x3FFF, sin_val, cos_val);
+        result = sin_val ^ cos_val;
     }
     end = std::chrono::high_resolution_clock::now();
     duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-    std::cout << "Atan2:    " << std::setw(8) << duration.count() << " μs for " 
+    std::cout << "Sincos:   " << std::setw(8) << duration.count() << " μs for " 
               << iterations << " ops (" 
               << (duration.count() * 1000.0 / iterations) << " ns/op)\n";
     
+    // Benchmark Q31 sin over 32-bit angles (linear 1024 / Hermite 256)
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        result = static_cast<int16_t>(TrigQ31::sin(static_cast<uint32_t>(i) * 2654435761u) >> 16);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    std::cout << "Sin Q31:  " << std::setw(8) << duration.count() << " μs for " 
+              << iterations << " ops (" 
+              << (duration.count() * 1000.0 / iterations) << " ns/op)\n";
+    
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        result = static_cast<int16_t>(TrigQ31Hermite::sin(static_cast<uint32_t>(i) * 2654435761u) >> 16);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    std::cout << "Sin Q31 H:" << std::setw(8) << duration.count() << " μs for " 
+              << iterations << " ops (" 
+              << (duration.count() * 1000.0 / iterations) << " ns/op)\n";
+    
+    // Benchmark batch sin over the same angle sequence
+    std::vector<uint16_t> angles(4096);
+    std::vector<int16_t> values(angles.size());
+    for (std::size_t i = 0; i < angles.size(); ++i) {
+        angles[i] = static_cast<uint16_t>(i * 7);
+    }
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i += static_cast<int>(angles.size())) {
+        Trig128::sin_batch(angles, values);
+        result = values[i & 0xFFF];
+    }
+    end = std::chrono::high_resolution_clock::now();
+    duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    std::cout << "Sin batch:" << std::setw(8) << duration.count() << " μs for " 
+              << iterations << " ops (" 
+              << (duration.count() * 1000.0 / iterations) << " ns/op)\n";
+    
+    // Benchmark oscillator block generation
+    Oscillator<Trig128> nco(Oscillator<Trig128>::increment_for(1000, 48000));
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i += static_cast<int>(values.size())) {
+        nco.fill(values);
+        result = values[i & 0xFFF];
+    }
+    end = std::chrono::high_resolution_clock::now();
+    duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    std::cout << "NCO fill: " << std::setw(8) << duration.count() << " μs for " 
+              << iterations << " ops (" 
+              << (duration.count() * 1000.0 / iterations) << " ns/op, " 
+              << (iterations / double(duration.count())) << " MS/s)\n";
+    
+    // Benchmark 1024-point FFT; each op is one full transform
+    constexpr std::size_t fft_size = 1024;
+    const int fft_iterations = iterations / 1000;
+    std::vector<ComplexQ15> frame(fft_size);
+    for (std::size_t n = 0; n < fft_size; ++n) {
+        frame[n] = {Trig128::sin(static_cast<uint16_t>(n * 37)), 0};
+    }
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < fft_iterations; ++i) {
+        result = static_cast<int16_t>(FFT<fft_size, Trig128>::forward(std::span<ComplexQ15, fft_size>(frame)));
+    }
+    end = std::chrono::high_resolution_clock::now();
+    duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    std::cout << "FFT 1024: " << std::setw(8) << duration.count() << " μs for " 
+              << fft_iterations << " ops (" 
+              << (duration.count() * 1000.0 / fft_iterations) << " ns/op)\n";
+    
+    // Benchmark 8 DTMF bins over 205-sample blocks: dft_bin vs Goertzel
+    // Each op is one input sample through all 8 bins
+    constexpr std::array<uint16_t, 8> dtmf_steps = {
+        1427, 1577, 1743, 1927, 2476, 2736, 3025, 3344};  // 697 .. 1633 Hz at 8 kHz
+    std::vector<int16_t> tones(205);
+    for (std::size_t n = 0; n < tones.size(); ++n) {
+        tones[n] = static_cast<int16_t>(Trig128::sin(static_cast<uint16_t>(n * 1427)) / 2 +
+                                        Trig128::sin(static_cast<uint16_t>(n * 2476)) / 2);
+    }
+    const int tone_blocks = iterations / static_cast<int>(tones.size()) / 10;
+    SignalProcessor dft;
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < tone_blocks; ++i) {
+        for (std::size_t k = 0; k < dtmf_steps.size(); ++k) {
+            // dft_bin takes an integer bin index; 205 * step / 16384 ≈ 18 .. 42
+            result = dft.dft_bin(tones.data(), tones.size(), (dtmf_steps[k] * tones.size()) >> 14).real;
+        }
+    }
+    end = std::chrono::high_resolution_clock::now();
+    duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    const int tone_samples = tone_blocks * static_cast<int>(tones.size());
+    std::cout << "DFT bin x8:" << std::setw(7) << duration.count() << " μs for " 
+              << tone_samples << " ops (" 
+              << (duration.count() * 1000.0 / tone_samples) << " ns/op)\n";
+    
+    Goertzel<Trig128, 8> dtmf(dtmf_steps);
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < tone_blocks; ++i) {
+        dtmf.reset();
+        dtmf.update(tones);
+        result = static_cast<int16_t>(dtmf.magnitude(i & 7));
+    }
+    end = std::chrono::high_resolution_clock::now();
+    duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    std::cout << "Goertzel x8:" << std::setw(6) << duration.count() << " μs for " 
+              << tone_samples << " ops (" 
+              << (duration.count() * 1000.0 / tone_samples) << " ns/op)\n";
+    
+    SlidingDFT<160, Trig128, 8> mains({1, 2, 3, 4, 5, 6, 7, 8});  // 50 Hz and harmonics at 8 kHz
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < tone_blocks; ++i) {
+        mains.update(tones);
+        result = static_cast<int16_t>(mains.magnitude(i & 7));
+    }
+    end = std::chrono::high_resolution_clock::now();
+    duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    std::cout << "Sliding DFT x8:" << std::setw(3) << duration.count() << " μs for " 
+              << tone_samples << " ops (" 
+              << (duration.count() * 1000.0 / tone_samples) << " ns/op)\n";
+    
+    // Benchmark atan2 over three input orders. Sorted: the old monotone
+    // first-quadrant sweep, branches always predicted. Random: uniform
+    // vectors, signs and octant flip at random. Adversarial: near-diagonal
+    // vectors with random signs and one in four on an axis, so every
+    // data-dependent branch is a coin toss. One entry per op, so the branch
+    // predictor cannot learn a repeating pattern.
+    std::vector<int16_t> atan_x(iterations), atan_y(iterations);
+    auto benchmark_atan2 = [&](const char* label) {
+        start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            result = Trig128::atan2(atan_y[i], atan_x[i]);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+        std::cout << label << std::setw(8) << duration.count() << " μs for " 
+                  << iterations << " ops (" 
+                  << (duration.count() * 1000.0 / iterations) << " ns/op)\n";
+    };
+    
+    for (int i = 0; i < iterations; ++i) {
+        atan_x[i] = static_cast<int16_t>((i >> 4) & 0x1FFF);
+        atan_y[i] = static_cast<int16_t>(i & 0x1FFF);
+    }
+    benchmark_atan2("Atan2 sorted:");
+    
+    uint32_t atan_seed = 99;
+    for (int i = 0; i < iterations; ++i) {
+        atan_seed = atan_seed * 1664525u + 1013904223u;
+        atan_x[i] = static_cast<int16_t>(atan_seed >> 16);
+        atan_seed = atan_seed * 1664525u + 1013904223u;
+        atan_y[i] = static_cast<int16_t>(atan_seed >> 16);
+    }
+    benchmark_atan2("Atan2 random:");
+    
+    for (int i = 0; i < iterations; ++i) {
+        atan_seed = atan_seed * 1664525u + 1013904223u;
+        int16_t base = static_cast<int16_t>(1000 + ((atan_seed >> 8) & 0x3FFF));
+        int16_t skew = static_cast<int16_t>(((atan_seed >> 4) & 0xF) - 8);
+        int16_t sx = (atan_seed & 0x80000000u) ? -1 : 1;
+        int16_t sy = (atan_seed & 0x40000000u) ? -1 : 1;
+        bool axis = (atan_seed & 0x30000000u) == 0;
+        bool x_axis = atan_seed & 0x08000000u;
+        atan_x[i] = static_cast<int16_t>((axis && x_axis) ? 0 : sx * base);
+        atan_y[i] = static_cast<int16_t>((axis && !x_axis) ? 0 : sy * (base + skew));
+    }
+    benchmark_atan2("Atan2 advers:");
+    
     // Benchmark magnitude
     start = std::chrono::high_resolution_clock::now();
     for (int i = 0; i < iterations; ++i) {
@@ -249,9 +438,723 @@ void benchmark() {
     std::cout << "Magnitude:" << std::setw(8) << duration.count() << " μs for " 
               << iterations << " ops (" 
               << (duration.count() * 1000.0 / iterations) << " ns/op)\n";
+    
+    // Benchmark batch magnitude over SoA arrays
+    std::vector<int32_t> mag_x(4096), mag_y(4096), mag_out(4096);
+    for (std::size_t i = 0; i < mag_x.size(); ++i) {
+        mag_x[i] = i & 0x1FFF;
+        mag_y[i] = (i * 37) & 0x1FFF;
+    }
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i += static_cast<int>(mag_x.size())) {
+        Trig128::magnitude_batch(mag_x, mag_y, mag_out);
+        result = mag_out[i & 0xFFF];
+    }
+    end = std::chrono::high_resolution_clock::now();
+    duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    std::cout << "Mag batch:" << std::setw(8) << duration.count() << " μs for " 
+              << iterations << " ops (" 
+              << (duration.count() * 1000.0 / iterations) << " ns/op)\n";
+    
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i += static_cast<int>(mag_x.size())) {
+        Trig128::magnitude_batch<MagnitudeAlphaBeta>(mag_x, mag_y, mag_out);
+        result = mag_out[i & 0xFFF];
+    }
+    end = std::chrono::high_resolution_clock::now();
+    duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    std::cout << "Mag fast: " << std::setw(8) << duration.count() << " μs for " 
+              << iterations << " ops (" 
+              << (duration.count() * 1000.0 / iterations) << " ns/op)\n";
+    
+    // Benchmark to_polar (angle and magnitude from one CORDIC pass)
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        auto polar = Trig128::to_polar(i & 0x1FFF, (i >> 4) & 0x1FFF);
+        result = polar.angle ^ polar.magnitude;
+    }
+    end = std::chrono::high_resolution_clock::now();
+    duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    std::cout << "To polar: " << std::setw(8) << duration.count() << " μs for " 
+              << iterations << " ops (" 
+              << (duration.count() * 1000.0 / iterations) << " ns/op)\n";
+}
+
+// atan2 policy benchmark: inputs cover all eight octants in shuffled order
+template<typename TrigImpl>
+void benchmark_atan2_policy(const char* name, const std::vector<int16_t>& xs,
+                            const std::vector<int16_t>& ys) {
+    const int rounds = 64;
+    const std::size_t count = xs.size();
+    volatile uint16_t sink = 0;
+    
+    auto start = std::chrono::high_resolution_clock::now();
+#if defined(__x86_64__) || defined(__i386__)
+    uint64_t cycles_start = __rdtsc();
+#endif
+    for (int r = 0; r < rounds; ++r) {
+        for (std::size_t i = 0; i < count; ++i) {
+            sink = TrigImpl::atan2(ys[i], xs[i]);
+        }
+    }
+#if defined(__x86_64__) || defined(__i386__)
+    uint64_t cycles = __rdtsc() - cycles_start;
+#endif
+    auto end = std::chrono::high_resolution_clock::now();
+    (void)sink;
+    
+    double ops = double(rounds) * count;
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    std::cout << std::setw(12) << name << ": " << std::setw(7) << std::setprecision(2)
+              << (ns / ops) << " ns/op";
+#if defined(__x86_64__) || defined(__i386__)
+    std::cout << std::setw(8) << (cycles / ops) << " cycles/op (TSC)";
+#endif
+    std::cout << "\n";
+}
+
+void benchmark_atan2() {
+    std::cout << "\natan2 Policies (Trig128, all octants):\n";
+    std::cout << "=====================================\n";
+    
+    std::vector<int16_t> xs, ys;
+    uint32_t seed = 12345;
+    for (int i = 0; i < 16384; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        uint16_t angle = seed >> 18;
+        int32_t radius = 64 + ((seed >> 4) & 0x3FFF);
+        xs.push_back(static_cast<int16_t>((radius * Trig128::cos(angle)) >> 14));
+        ys.push_back(static_cast<int16_t>((radius * Trig128::sin(angle)) >> 14));
+    }
+    
+    benchmark_atan2_policy<IntegerTrig<128, AtanDivide>>("Divide", xs, ys);
+    benchmark_atan2_policy<IntegerTrig<128, AtanReciprocal>>("Reciprocal", xs, ys);
+    benchmark_atan2_policy<IntegerTrig<128, AtanCordic>>("CORDIC", xs, ys);
+}
+
+template<typename TrigImpl>
+double sin_stream_ns(const std::vector<uint16_t>& angles) {
+    const int rounds = 64;
+    volatile int32_t sink = 0;
+    
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        int32_t acc = 0;
+        for (uint16_t a : angles) {
+            acc += TrigImpl::sin(a);
+        }
+        sink = acc;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    (void)sink;
+    return std::chrono::duration<double, std::nano>(end - start).count() / (double(rounds) * angles.size());
+}
+
+template<std::size_t TableSize>
+void benchmark_layout_size(const std::vector<uint16_t>& sequential, const std::vector<uint16_t>& random) {
+    using Split = IntegerTrig<TableSize>;
+    using Interleaved = IntegerTrig<TableSize, AtanDivide, InterpolateLinear, LayoutInterleaved>;
+    
+    std::cout << std::setw(6) << TableSize << std::fixed << std::setprecision(2)
+              << std::setw(10) << sin_stream_ns<Split>(sequential)
+              << std::setw(13) << sin_stream_ns<Interleaved>(sequential)
+              << std::setw(10) << sin_stream_ns<Split>(random)
+              << std::setw(13) << sin_stream_ns<Interleaved>(random) << "\n";
+}
+
+void benchmark_layout() {
+    std::cout << "\nSine Table Layout (ns/op, scalar sin):\n";
+    std::cout << "=====================================\n";
+    std::cout << "  Size  Seq split  Seq interleaved  Rand split  Rand interleaved\n";
+    
+    // Sequential: a slow sweep, neighbouring angles hit the same entries.
+    // Random: uniformly scattered angles, every lookup a new entry.
+    std::vector<uint16_t> sequential(1 << 16), random(1 << 16);
+    uint32_t seed = 2024;
+    for (std::size_t i = 0; i < sequential.size(); ++i) {
+        sequential[i] = static_cast<uint16_t>(i >> 2);
+        seed = seed * 1664525u + 1013904223u;
+        random[i] = static_cast<uint16_t>(seed >> 16);
+    }
+    
+    benchmark_layout_size<128>(sequential, random);
+    benchmark_layout_size<1024>(sequential, random);
+    benchmark_layout_size<4096>(sequential, random);
+}
+
+template<typename TrigImpl>
+void benchmark_backend(const char* name, const std::vector<uint16_t>& angles,
+                       const std::vector<int16_t>& xs, const std::vector<int16_t>& ys) {
+    const int rounds = 64;
+    volatile uint16_t sink = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        uint16_t acc = 0;
+        for (std::size_t i = 0; i < xs.size(); ++i) {
+            acc ^= TrigImpl::atan2(ys[i], xs[i]);
+        }
+        sink = acc;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    (void)sink;
+    double atan2_ns = std::chrono::duration<double, std::nano>(end - start).count() / (double(rounds) * xs.size());
+    
+    std::cout << std::setw(12) << name << std::setw(8) << TrigImpl::table_memory()
+              << std::fixed << std::setprecision(2)
+              << std::setw(10) << sin_stream_ns<TrigImpl>(angles)
+              << std::setw(10) << atan2_ns << "\n";
+}
+
+void benchmark_backends() {
+    std::cout << "\nTable vs Polynomial Backends (scattered inputs):\n";
+    std::cout << "===============================================\n";
+    std::cout << "     Backend   Bytes  sin ns  atan2 ns\n";
+    
+    std::vector<uint16_t> angles(1 << 14);
+    std::vector<int16_t> xs(1 << 14), ys(1 << 14);
+    uint32_t seed = 4242;
+    for (std::size_t i = 0; i < angles.size(); ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        angles[i] = static_cast<uint16_t>(seed >> 18);
+        xs[i] = static_cast<int16_t>(seed >> 16);
+        seed = seed * 1664525u + 1013904223u;
+        ys[i] = static_cast<int16_t>(seed >> 16);
+    }
+    
+    benchmark_backend<Trig32>("Trig32", angles, xs, ys);
+    benchmark_backend<Trig64>("Trig64", angles, xs, ys);
+    benchmark_backend<Trig128>("Trig128", angles, xs, ys);
+    benchmark_backend<Trig256>("Trig256", angles, xs, ys);
+    benchmark_backend<Trig512>("Trig512", angles, xs, ys);
+    benchmark_backend<PolyTrig<3>>("PolyTrig<3>", angles, xs, ys);
+    benchmark_backend<PolyTrig<5>>("PolyTrig<5>", angles, xs, ys);
+    benchmark_backend<PolyTrig<7>>("PolyTrig<7>", angles, xs, ys);
+}
+
+template<typename TrigImpl>
+void benchmark_storage_row(const char* name, const std::vector<int16_t>& xs, const std::vector<int16_t>& ys) {
+    const int rounds = 64;
+    volatile uint16_t sink = 0;
+    
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        uint16_t acc = 0;
+        for (int16_t x : xs) {
+            acc ^= TrigImpl::asin(static_cast<int16_t>(x >> 1));
+        }
+        sink = acc;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double asin_ns = std::chrono::duration<double, std::nano>(end - start).count() / (double(rounds) * xs.size());
+    
+    start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        uint16_t acc = 0;
+        for (std::size_t i = 0; i < xs.size(); ++i) {
+            acc ^= TrigImpl::atan2(ys[i], xs[i]);
+        }
+        sink = acc;
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double atan2_ns = std::chrono::duration<double, std::nano>(end - start).count() / (double(rounds) * xs.size());
+    (void)sink;
+    
+    std::cout << std::setw(16) << name << std::setw(8) << TrigImpl::table_memory()
+              << std::fixed << std::setprecision(2)
+              << std::setw(10) << asin_ns << std::setw(10) << atan2_ns << "\n";
+}
+
+void benchmark_storage() {
+    std::cout << "\nFull vs Minimal Table Storage (scattered inputs):\n";
+    std::cout << "=================================================\n";
+    std::cout << "         Storage   Bytes asin ns  atan2 ns\n";
+    
+    std::vector<int16_t> xs(1 << 14), ys(1 << 14);
+    uint32_t seed = 777;
+    for (std::size_t i = 0; i < xs.size(); ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        xs[i] = static_cast<int16_t>(seed >> 16);
+        seed = seed * 1664525u + 1013904223u;
+        ys[i] = static_cast<int16_t>(seed >> 16);
+    }
+    
+    benchmark_storage_row<Trig128>("Trig128", xs, ys);
+    benchmark_storage_row<TrigMinimal<128>>("TrigMinimal<128>", xs, ys);
+    benchmark_storage_row<Trig512>("Trig512", xs, ys);
+    benchmark_storage_row<TrigMinimal<512>>("TrigMinimal<512>", xs, ys);
+}
+
+template<typename Atan2>
+void benchmark_atan2_row(const char* name, std::size_t bytes, Atan2 atan2,
+                         const std::vector<int16_t>& xs, const std::vector<int16_t>& ys) {
+    const int rounds = 64;
+    volatile uint16_t sink = 0;
+    double max_error = 0;
+    for (std::size_t i = 0; i < xs.size(); ++i) {
+        double expected = std::atan2(double(ys[i]), double(xs[i])) / (2.0 * M_PI) * 16384.0;
+        double diff = atan2(ys[i], xs[i]) - expected;
+        diff -= 16384.0 * std::round(diff / 16384.0);
+        max_error = std::max(max_error, std::abs(diff));
+    }
+    
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        uint16_t acc = 0;
+        for (std::size_t i = 0; i < xs.size(); ++i) {
+            acc ^= atan2(ys[i], xs[i]);
+        }
+        sink = acc;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    (void)sink;
+    double ns = std::chrono::duration<double, std::nano>(end - start).count() / (double(rounds) * xs.size());
+    
+    std::cout << std::setw(14) << name << std::setw(8) << bytes << std::fixed << std::setprecision(2)
+              << std::setw(10) << ns << std::setw(11) << max_error << "\n";
+}
+
+void benchmark_atan2_lut() {
+    std::cout << "\natan2 on 10-bit Joystick Inputs (±511):\n";
+    std::cout << "=======================================\n";
+    std::cout << "        Method   Bytes  atan2 ns  max error\n";
+    
+    std::vector<int16_t> xs(1 << 14), ys(1 << 14);
+    uint32_t seed = 2024;
+    for (std::size_t i = 0; i < xs.size(); ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        xs[i] = static_cast<int16_t>(int32_t(seed >> 22) - 512);
+        seed = seed * 1664525u + 1013904223u;
+        ys[i] = static_cast<int16_t>(int32_t(seed >> 22) - 512);
+    }
+    
+    benchmark_atan2_row("Trig128", Trig128::table_memory(),
+                        [](int16_t y, int16_t x) { return Trig128::atan2(y, x); }, xs, ys);
+    benchmark_atan2_row("atan2_lut<5>", atan2_lut_memory<5>(),
+                        [](int16_t y, int16_t x) { return atan2_lut<5>(y, x); }, xs, ys);
+    benchmark_atan2_row("atan2_lut<6>", atan2_lut_memory<6>(),
+                        [](int16_t y, int16_t x) { return atan2_lut<6>(y, x); }, xs, ys);
+    benchmark_atan2_row("atan2_lut<8>", atan2_lut_memory<8>(),
+                        [](int16_t y, int16_t x) { return atan2_lut<8>(y, x); }, xs, ys);
+}
+
+// ns per point for one frame of `rotate_all` over `points` points
+template<typename RotateAll>
+double rotor_frame_ns(RotateAll rotate_all, std::size_t points) {
+    const int frames = 256;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int f = 0; f < frames; ++f) {
+        rotate_all(static_cast<uint16_t>(f * 37));
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (double(frames) * points);
+}
+
+void benchmark_rotor() {
+    std::cout << "\nRotating a 4096-Point Cloud by One Heading (ns/point):\n";
+    std::cout << "=====================================================\n";
+    
+    using V = Vector2D<Trig128>;
+    using R = Rotor<Trig128>;
+    std::vector<V::Vec2> cloud(4096), aos(cloud.size());
+    std::vector<int16_t> xs(cloud.size()), ys(cloud.size()), x_out(cloud.size()), y_out(cloud.size());
+    uint32_t seed = 99;
+    for (std::size_t i = 0; i < cloud.size(); ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        cloud[i] = {static_cast<int16_t>(seed >> 20), static_cast<int16_t>((seed >> 4) & 0xFFF)};
+        xs[i] = cloud[i].x;
+        ys[i] = cloud[i].y;
+    }
+    volatile int16_t sink = 0;
+    
+    // The volatile heading stops the compiler hoisting the lookup, as it
+    // could not across a call into another translation unit
+    double per_call = rotor_frame_ns([&](uint16_t heading) {
+        volatile uint16_t current = heading;
+        for (std::size_t i = 0; i < cloud.size(); ++i) aos[i] = V::rotate(cloud[i], current);
+        sink = aos[heading & 0xFFF].x;
+    }, cloud.size());
+    double cached = rotor_frame_ns([&](uint16_t heading) {
+        R rotor(Angle14::from_raw(heading));
+        for (std::size_t i = 0; i < cloud.size(); ++i) aos[i] = rotor.rotate(cloud[i]);
+        sink = aos[heading & 0xFFF].x;
+    }, cloud.size());
+    double batch_aos = rotor_frame_ns([&](uint16_t heading) {
+        R(Angle14::from_raw(heading)).apply(cloud, aos);
+        sink = aos[heading & 0xFFF].x;
+    }, cloud.size());
+    double batch_soa = rotor_frame_ns([&](uint16_t heading) {
+        R(Angle14::from_raw(heading)).apply(xs, ys, x_out, y_out);
+        sink = x_out[heading & 0xFFF];
+    }, cloud.size());
+    (void)sink;
+    
+    std::cout << std::fixed << std::setprecision(3)
+              << "Vector2D::rotate per point: " << std::setw(7) << per_call << "\n"
+              << "Rotor::rotate loop:         " << std::setw(7) << cached << "\n"
+              << "Rotor::apply (AoS):         " << std::setw(7) << batch_aos << "\n"
+              << "Rotor::apply (SoA):         " << std::setw(7) << batch_soa << "\n";
+}
+
+void benchmark_lidar() {
+    std::cout << "\nLidar Sweep, 2048 Points per Frame (ns/point):\n";
+    std::cout << "==============================================\n";
+    
+    using V = Vector2D<Trig128>;
+    static V::Vec2Array<2048> points, cartesian;
+    static V::PolarArray<2048> polar;
+    points.count = polar.count = 2048;
+    uint32_t seed = 11;
+    for (std::size_t i = 0; i < points.count; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        polar.angle[i] = static_cast<uint16_t>(i * 8);               // one sweep
+        polar.magnitude[i] = static_cast<int16_t>(200 + (seed >> 20)); // 200..4295 mm
+    }
+    V::from_polar(polar, points);
+    volatile int16_t sink = 0;
+    
+    // Same frame both ways: per-point calls, then one batch call
+    double single_to = rotor_frame_ns([&](uint16_t) {
+        for (std::size_t i = 0; i < points.count; ++i) {
+            V::Polar p = V::to_polar({points.x[i], points.y[i]});
+            polar.angle[i] = p.angle;
+            polar.magnitude[i] = p.magnitude;
+        }
+        sink = polar.magnitude[7];
+    }, points.count);
+    double batch_to = rotor_frame_ns([&](uint16_t) {
+        V::to_polar(points, polar);
+        sink = polar.magnitude[7];
+    }, points.count);
+    double single_from = rotor_frame_ns([&](uint16_t) {
+        for (std::size_t i = 0; i < polar.count; ++i) {
+            V::Vec2 v = V::from_polar({polar.angle[i], polar.magnitude[i]});
+            cartesian.x[i] = v.x;
+            cartesian.y[i] = v.y;
+        }
+        sink = cartesian.x[7];
+    }, points.count);
+    double batch_from = rotor_frame_ns([&](uint16_t) {
+        V::from_polar(polar, cartesian);
+        sink = cartesian.x[7];
+    }, points.count);
+    (void)sink;
+    
+    std::cout << std::fixed << std::setprecision(2)
+              << "                 per point    batch\n"
+              << "to_polar:        " << std::setw(9) << single_to << std::setw(9) << batch_to << "\n"
+              << "from_polar:      " << std::setw(9) << single_from << std::setw(9) << batch_from << "\n";
+}
+
+// One FOC cycle per sample, single steps and the batch over a recorded run
+void benchmark_foc() {
+    std::cout << "\nFOC Current Loop, 4096 Cycles (ns/cycle):\n";
+    std::cout << "=========================================\n";
+    
+    using Foc = FOC<Trig128>;
+    const Foc foc(MotorController::PWM_PERIOD);
+    const std::size_t cycles = 4096;
+    std::vector<PhaseCurrents> currents(cycles);
+    std::vector<Angle14> angles(cycles);
+    std::vector<DQ> voltages(cycles);
+    std::vector<Foc::Cycle> out(cycles);
+    uint32_t seed = 21;
+    for (std::size_t i = 0; i < cycles; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        angles[i] = Angle14::from_raw(static_cast<uint32_t>(i * 53));
+        currents[i] = {static_cast<int16_t>(seed >> 20), static_cast<int16_t>(-(seed >> 21))};
+        voltages[i] = {static_cast<int16_t>(seed >> 22), static_cast<int16_t>(seed >> 18)};
+    }
+    volatile uint16_t sink = 0;
+    
+    double fused = rotor_frame_ns([&](uint16_t) {
+        for (std::size_t i = 0; i < cycles; ++i) {
+            out[i] = foc.run(currents[i], angles[i], voltages[i]);
+        }
+        sink = out[7].duty.a;
+    }, cycles);
+    double batch = rotor_frame_ns([&](uint16_t) {
+        foc.run(currents, angles, voltages, out);
+        sink = out[7].duty.a;
+    }, cycles);
+    (void)sink;
+    
+    std::cout << std::fixed << std::setprecision(2)
+              << "FOC::run:        " << std::setw(8) << fused << "\n"
+              << "FOC::run batch:  " << std::setw(8) << batch << "\n";
+}
+
+// Resolver at 1500 rpm with ±100 counts of noise: atan2 on every sample
+// and a difference for speed, against the tracking observer
+void benchmark_observer() {
+    std::cout << "\nResolver Angle and Speed, 20 kHz Samples:\n";
+    std::cout << "=========================================\n";
+    
+    const std::size_t count = 16384;
+    const int amplitude = 12000;
+    std::vector<int16_t> sines(count), cosines(count);
+    std::vector<double> truth(count);
+    uint32_t seed = 5;
+    for (std::size_t k = 0; k < count; ++k) {
+        seed = seed * 1664525u + 1013904223u;
+        double noise = (double(seed >> 16) / 65536.0 - 0.5) * 200;
+        truth[k] = 1500.0 / 60 / 20000 * double(k);
+        sines[k] = static_cast<int16_t>(std::lround(amplitude * std::sin(2 * M_PI * truth[k]) + noise));
+        cosines[k] = static_cast<int16_t>(std::lround(amplitude * std::cos(2 * M_PI * truth[k]) - noise));
+    }
+    std::vector<Angle14> angles(count);
+    std::vector<int32_t> speeds(count);
+    volatile int32_t sink = 0;
+    
+    double atan2_ns = rotor_frame_ns([&](uint16_t) {
+        uint16_t previous = Trig128::atan2(sines[0], cosines[0]);
+        for (std::size_t k = 0; k < count; ++k) {
+            uint16_t angle = Trig128::atan2(sines[k], cosines[k]);
+            angles[k] = Angle14::from_raw(angle);
+            speeds[k] = Angle14::from_raw(angle - previous).to_signed();
+            previous = angle;
+        }
+        sink = speeds[7];
+    }, count);
+    auto spread = [&](auto speed_rpm) {
+        double angle_sq = 0, speed_sq = 0;
+        for (std::size_t k = 2000; k < count; ++k) {
+            angle_sq += std::pow(std::remainder(angles[k].raw() - truth[k] * 16384, 16384.0), 2);
+            speed_sq += std::pow(speed_rpm(speeds[k]) - 1500.0, 2);
+        }
+        return std::make_pair(std::sqrt(angle_sq / (count - 2000)), std::sqrt(speed_sq / (count - 2000)));
+    };
+    auto [atan2_angle, atan2_speed] = spread([](int32_t units) { return units * 20000.0 * 60 / 16384; });
+    
+    TrackingObserver<Trig128> observer(300, 20000, amplitude);
+    double observer_ns = rotor_frame_ns([&](uint16_t) {
+        observer.acquire(sines[0], cosines[0]);
+        observer.update(sines, cosines, angles, speeds);
+        sink = speeds[7];
+    }, count);
+    (void)sink;
+    auto [observer_angle, observer_speed] = spread([](int32_t units) { return units * 20000.0 * 60 / 4294967296.0; });
+    
+    std::cout << std::fixed << std::setprecision(2)
+              << "                     ns/sample  angle rms (units)  speed rms (rpm)\n"
+              << "atan2 + difference:  " << std::setw(9) << atan2_ns << std::setw(19) << atan2_angle
+              << std::setw(17) << atan2_speed << "\n"
+              << "TrackingObserver:    " << std::setw(9) << observer_ns << std::setw(19) << observer_angle
+              << std::setw(17) << observer_speed << "\n";
+}
+
+// Odometry: replay one million encoder samples of a wandering drive and
+// compare the pose with an exact-arc integration in double
+void benchmark_odometry() {
+    std::cout << "\nDifferential-Drive Odometry, 1M Encoder Samples:\n";
+    std::cout << "================================================\n";
+    
+    const std::size_t count = 1000000;
+    const double tick = RobotNavigator::TICK_LENGTH.raw() / 65536.0;
+    const double track = RobotNavigator::TRACK_WIDTH.raw() / 65536.0;
+    std::vector<int32_t> left(count), right(count);
+    uint32_t seed = 23;
+    int turn = 0;
+    for (std::size_t k = 0; k < count; ++k) {
+        seed = seed * 1664525u + 1013904223u;
+        if (k % 1000 == 0) {
+            turn = int(seed >> 24) % 5 - 2;   // new curvature every 1000 samples
+        }
+        left[k] = 10 - turn + int(seed >> 8) % 3 - 1;
+        right[k] = 10 + turn + int(seed >> 16) % 3 - 1;
+    }
+    
+    // Reference and its cost
+    double ref_x = 0, ref_y = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    int64_t difference = 0;
+    for (std::size_t k = 0; k < count; ++k) {
+        double theta = double(difference) * tick / track;
+        double turn_angle = (right[k] - left[k]) * tick / track;
+        double arc = (left[k] + right[k]) * tick / 2;
+        double chord = turn_angle == 0 ? arc : arc * std::sin(turn_angle / 2) / (turn_angle / 2);
+        ref_x += chord * std::cos(theta + turn_angle / 2);
+        ref_y += chord * std::sin(theta + turn_angle / 2);
+        difference += right[k] - left[k];
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double reference_ns = std::chrono::duration<double, std::nano>(end - start).count() / count;
+    double ref_heading = std::remainder(double(difference) * tick / track, 2 * M_PI);
+    
+    // RobotNavigator::move per sample, heading from the tick difference
+    RobotNavigator nav;
+    RobotNavigator::Position naive{0, 0};
+    start = std::chrono::high_resolution_clock::now();
+    difference = 0;
+    for (std::size_t k = 0; k < count; ++k) {
+        difference += right[k] - left[k];
+        auto heading = static_cast<uint16_t>(std::lround(double(difference) * tick / track * 16384 / (2 * M_PI)));
+        naive = nav.move(naive, heading, static_cast<int32_t>(std::lround((left[k] + right[k]) * tick / 2)));
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double naive_ns = std::chrono::duration<double, std::nano>(end - start).count() / count;
+    
+    Odometry<> odometry(RobotNavigator::TICK_LENGTH, RobotNavigator::TRACK_WIDTH);
+    start = std::chrono::high_resolution_clock::now();
+    odometry.update(left, right);
+    end = std::chrono::high_resolution_clock::now();
+    double odometry_ns = std::chrono::duration<double, std::nano>(end - start).count() / count;
+    double odo_x = odometry.x().raw() / 4294967296.0, odo_y = odometry.y().raw() / 4294967296.0;
+    double odo_heading = std::remainder(odometry.heading().raw() / 4294967296.0 * 2 * M_PI - ref_heading, 2 * M_PI);
+    
+    std::cout << std::fixed << std::setprecision(3)
+              << "Distance driven: " << double(count) * 10 * tick / 1000 << " m, final pose ("
+              << ref_x << ", " << ref_y << ") mm\n"
+              << "                          ns/sample   position error (mm)\n"
+              << "double exact arc:         " << std::setw(9) << reference_ns << "   reference\n"
+              << "RobotNavigator::move:     " << std::setw(9) << naive_ns << std::setw(22)
+              << std::hypot(naive.x - ref_x, naive.y - ref_y) << "\n"
+              << "Odometry<TrigQ31Hermite>: " << std::setw(9) << odometry_ns << std::setw(22)
+              << std::setprecision(6) << std::hypot(odo_x - ref_x, odo_y - ref_y) << "\n"
+              << "Odometry heading error: " << std::scientific << std::setprecision(2) << odo_heading
+              << " rad\n" << std::defaultfloat;
+}
+
+// Planar arm IK and FK over a trajectory block, against <cmath>
+void benchmark_kinematics() {
+    std::cout << "\nPlanar Arm Kinematics, 512-Waypoint Trajectory:\n";
+    std::cout << "===============================================\n";
+    
+    using Arm = Kinematics<Trig256>;
+    const int upper = 30000, lower = 25000, hand = 8000;   // 0.01 mm
+    const std::size_t count = 512;
+    
+    // Figure of eight across most of the workspace
+    std::vector<Arm::Point> points(count);
+    std::vector<Arm::Pose> poses(count);
+    for (std::size_t k = 0; k < count; ++k) {
+        double t = 2 * M_PI * double(k) / count;
+        points[k] = {static_cast<int32_t>(std::lround(30000 + 20000 * std::sin(t))),
+                     static_cast<int32_t>(std::lround(10000 + 15000 * std::sin(2 * t)))};
+        poses[k] = {points[k], Angle14::from_raw(static_cast<uint32_t>(std::lround(t * 1000)))};
+    }
+    std::vector<Arm::Joints> joints(count), wrist_joints(count);
+    std::vector<Arm::Pose> reached(count);
+    volatile int32_t sink = 0;
+    
+    Arm two(upper, lower), three(upper, lower, hand);
+    double two_ns = rotor_frame_ns([&](uint16_t) {
+        sink = static_cast<int32_t>(two.solve(points, joints));
+    }, count);
+    double three_ns = rotor_frame_ns([&](uint16_t) {
+        sink = static_cast<int32_t>(three.solve(poses, wrist_joints));
+    }, count);
+    double forward_ns = rotor_frame_ns([&](uint16_t) {
+        three.forward(wrist_joints, reached);
+        sink = reached[7].position.x;
+    }, count);
+    
+    std::vector<double> shoulders(count), elbows(count);
+    double double_ns = rotor_frame_ns([&](uint16_t) {
+        for (std::size_t k = 0; k < count; ++k) {
+            double x = points[k].x, y = points[k].y;
+            double c = (x * x + y * y - double(upper) * upper - double(lower) * lower) / (2.0 * upper * lower);
+            elbows[k] = std::acos(std::clamp(c, -1.0, 1.0));
+            shoulders[k] = std::atan2(y, x) - std::atan2(lower * std::sin(elbows[k]), upper + lower * std::cos(elbows[k]));
+        }
+        sink = static_cast<int32_t>(shoulders[7]);
+    }, count);
+    (void)sink;
+    
+    // Exact forward kinematics of the returned angles against the targets
+    double two_error = 0, three_error = 0;
+    for (std::size_t k = 0; k < count; ++k) {
+        double s = joints[k].shoulder.raw() * M_PI / 8192, e = s + joints[k].elbow.raw() * M_PI / 8192;
+        two_error = std::max(two_error, std::hypot(upper * std::cos(s) + lower * std::cos(e) - points[k].x,
+                                                   upper * std::sin(s) + lower * std::sin(e) - points[k].y));
+        const Arm::Joints& j = wrist_joints[k];
+        s = j.shoulder.raw() * M_PI / 8192;
+        e = s + j.elbow.raw() * M_PI / 8192;
+        double w = e + j.wrist.raw() * M_PI / 8192;
+        three_error = std::max(three_error,
+            std::hypot(upper * std::cos(s) + lower * std::cos(e) + hand * std::cos(w) - points[k].x,
+                       upper * std::sin(s) + lower * std::sin(e) + hand * std::sin(w) - points[k].y));
+    }
+    
+    std::cout << std::fixed << std::setprecision(2)
+              << "Links 300/250/80 mm      ns/waypoint   max error (mm)\n"
+              << "Kinematics two-link IK:  " << std::setw(11) << two_ns << std::setw(17) << two_error / 100 << "\n"
+              << "Kinematics three-link IK:" << std::setw(11) << three_ns << std::setw(17) << three_error / 100 << "\n"
+              << "Kinematics forward batch:" << std::setw(11) << forward_ns << "\n"
+              << "double <cmath> IK:       " << std::setw(11) << double_ns << "\n";
 }
 
 // Main demonstration program
+// Quadrature mixer: per-sample sincos and rotate against Mixer blocks,
+// at 100 kS/s with a 12.5 kHz carrier
+void benchmark_mixer() {
+    std::cout << "\nQuadrature Mixer, 100 kS/s:\n";
+    std::cout << "===========================\n";
+    
+    const std::size_t count = 16384;
+    const uint32_t increment = Mixer<Trig128>::increment_for(-12500, 100000);
+    std::vector<ComplexQ15> in(count), out(count);
+    std::vector<int16_t> re(count), im(count), i_out(count), q_out(count);
+    uint32_t seed = 11;
+    for (std::size_t k = 0; k < count; ++k) {
+        seed = seed * 1664525u + 1013904223u;
+        // Within the unit circle, so no rotation clips
+        in[k] = {static_cast<int16_t>(int16_t(seed >> 16) * 23170 / 32768),
+                 static_cast<int16_t>(int16_t(seed) * 23170 / 32768)};
+        re[k] = in[k].re;
+        im[k] = in[k].im;
+    }
+    volatile int16_t sink = 0;
+    
+    // Largest error against the exact rotation of each input sample
+    auto worst = [&](auto sample) {
+        double error = 0;
+        for (std::size_t k = 0; k < count; ++k) {
+            std::complex<double> z(in[k].re, in[k].im);
+            std::complex<double> exact = z * std::polar(1.0, 2 * M_PI * double(uint32_t(k * increment)) / 4294967296.0);
+            error = std::max(error, std::abs(sample(k) - exact));
+        }
+        return error;
+    };
+    
+    double rotate_ns = rotor_frame_ns([&](uint16_t) {
+        uint32_t phase = 0;
+        for (std::size_t k = 0; k < count; ++k) {
+            int16_t s, c;
+            Trig128::sincos(static_cast<uint16_t>(phase >> 18), s, c);
+            out[k] = {static_cast<int16_t>((in[k].re * c - in[k].im * s) / 16384),
+                      static_cast<int16_t>((in[k].re * s + in[k].im * c) / 16384)};
+            phase += increment;
+        }
+        sink = out[7].re;
+    }, count);
+    double rotate_error = worst([&](std::size_t k) { return std::complex<double>(out[k].re, out[k].im); });
+    
+    Mixer<Trig128> mixer(increment);
+    double interleaved_ns = rotor_frame_ns([&](uint16_t) {
+        mixer.set_phase(0);
+        mixer.mix(in, out);
+        sink = out[7].re;
+    }, count);
+    double mixer_error = worst([&](std::size_t k) { return std::complex<double>(out[k].re, out[k].im); });
+    double split_ns = rotor_frame_ns([&](uint16_t) {
+        mixer.mix(re, im, i_out, q_out);
+        sink = i_out[7];
+    }, count);
+    double real_ns = rotor_frame_ns([&](uint16_t) {
+        mixer.mix(re, i_out, q_out);
+        sink = i_out[7];
+    }, count);
+    (void)sink;
+    
+    std::cout << std::fixed << std::setprecision(2)
+              << "                          ns/sample  max error (LSB)\n"
+              << "sincos + rotate per call: " << std::setw(9) << rotate_ns << std::setw(17) << rotate_error << "\n"
+              << "Mixer, interleaved:       " << std::setw(9) << interleaved_ns << std::setw(17) << mixer_error << "\n"
+              << "Mixer, split I/Q:         " << std::setw(9) << split_ns << "\n"
+              << "Mixer, real input:        " << std::setw(9) << real_ns << "\n"
+              << "CPU at 100 kS/s, interleaved: " << std::setprecision(3) << interleaved_ns * 100000 / 1e7 << "%\n";
+}
+
 int main() {
     std::cout << "FastTrig Library Examples\n";
     std::cout << "=========================\n\n";
@@ -270,19 +1173,19 @@ int main() {
     std::cout << std::string(37, '-') << "\n";
     
     for (int deg = 0; deg <= 360; deg += 30) {
-        uint16_t angle = AngleConvert::from_degrees(deg);
+        Angle14 angle = Degrees(deg);
         int16_t s = Trig128::sin(angle);
         int16_t c = Trig128::cos(angle);
         
         std::cout << std::setw(5) << deg << "°" 
                   << std::fixed << std::setprecision(4)
-                  << std::setw(10) << (s/16384.0 * 2.0)
-                  << std::setw(10) << (c/16384.0 * 2.0);
+                  << std::setw(10) << (s/16384.0)
+                  << std::setw(10) << (c/16384.0);
         
         if ((deg % 180 == 90)) {
             std::cout << std::setw(10) << "±∞";
         } else {
-            int16_t t = Trig128::tan(angle);
+            int16_t t = Trig128::tan(angle.raw());
             std::cout << std::setw(10) << (t/8192.0);
         }
         std::cout << "\n";
@@ -298,6 +1201,24 @@ int main() {
     auto new_pos = nav.move({0, 0}, target.heading, 500);
     std::cout << "After moving 500mm: (" << new_pos.x << ", " << new_pos.y << ")\n";
     
+    // Quarter circle of 500 mm radius: 6 and 10 ticks per sample turn
+    // 0.001 rad, so 1571 samples
+    std::vector<int32_t> left_ticks(1571, 6), right_ticks(1571, 10);
+    auto arc_end = nav.drive(left_ticks, right_ticks);
+    std::cout << "After a quarter circle of radius 500mm: (" << arc_end.x << ", " << arc_end.y << "), heading "
+              << std::lround(nav.heading().raw() * 360.0 / 4294967296.0) << "°\n";
+    
+    // Servo arm example
+    std::cout << "\nServo Arm Example:\n";
+    ServoController arm(300, 250);
+    auto joints = arm.inverse_kinematics(400, 200);
+    auto reached = arm.forward_kinematics(joints);
+    std::cout << "Reach (400, 200) with 300/250 mm links: shoulder "
+              << AngleConvert::to_degrees(joints.shoulder) << "°, elbow "
+              << AngleConvert::to_degrees(joints.elbow) << "°, lands at ("
+              << reached.x << ", " << reached.y << ")\n";
+    std::cout << "(600, 0) reachable: " << (arm.reachable(600, 0) ? "yes" : "no") << "\n";
+    
     // Signal processing example
     std::cout << "\nSignal Processing Example:\n";
     SignalProcessor dsp;
@@ -309,6 +1230,13 @@ int main() {
     dsp.generate_sine_wave(signal, samples, freq);
     
     std::cout << "Generated " << samples << " samples of sine wave\n";
+    
+    // Same tone from the 32-bit phase accumulator
+    int16_t nco_signal[samples];
+    Oscillator<Trig128> nco(uint32_t(1) << 29);  // 1/8 of sample rate
+    nco.fill(nco_signal);
+    std::cout << "Oscillator matches: " 
+              << (std::equal(signal, signal + samples, nco_signal) ? "yes" : "no") << "\n";
     std::cout << "First 8 samples: ";
     for (int i = 0; i < 8; ++i) {
         std::cout << signal[i] << " ";
@@ -318,13 +1246,51 @@ int main() {
     // Game physics example
     std::cout << "\nGame Physics Example:\n";
     GamePhysics physics;
-    uint16_t launch_angle = AngleConvert::from_degrees(45);
-    auto projectile = physics.launch(1000, launch_angle);
+    Angle14 launch_angle = 45_deg;
+    auto projectile = physics.launch(1000, launch_angle.raw());
     std::cout << "Projectile launched at 45°\n";
     std::cout << "Initial velocity: (" << projectile.vx << ", " << projectile.vy << ")\n";
     
+    // Motor control example
+    std::cout << "\nMotor Control Example:\n";
+    MotorController motor;
+    PwmDuty duty = motor.step({1200, -600}, 30_deg, 800);
+    std::cout << "Duties at 30°, 800 torque current: " << duty.a << " " << duty.b << " " << duty.c
+              << " of " << MotorController::PWM_PERIOD << "\n";
+    
+    // Complex tone 2 kHz above a 10 kHz carrier, mixed down in uneven blocks
+    std::vector<ComplexQ15> received(1000), baseband(1000);
+    Oscillator<Trig128> tone_i(Oscillator<>::increment_for(12000, 100000), uint32_t(1) << 30);
+    Oscillator<Trig128> tone_q(Oscillator<>::increment_for(12000, 100000));
+    for (auto& z : received) {
+        z = {tone_i.next(), tone_q.next()};
+    }
+    dsp.tune(10000, 100000);
+    dsp.downconvert(std::span(received).first(300), std::span(baseband).first(300));
+    dsp.downconvert(std::span(received).subspan(300), std::span(baseband).subspan(300));
+    int32_t turns = 0;
+    for (std::size_t k = 1; k < baseband.size(); ++k) {
+        uint16_t from = Trig128::atan2(baseband[k - 1].im, baseband[k - 1].re);
+        uint16_t to = Trig128::atan2(baseband[k].im, baseband[k].re);
+        turns += Angle14::from_raw(to - from).to_signed();
+    }
+    std::cout << "Tone after mixing down 10 kHz: "
+              << std::lround(turns / 16384.0 * 100000 / (baseband.size() - 1)) << " Hz\n";
+    
     // Run performance benchmark
     benchmark();
+    benchmark_atan2();
+    benchmark_layout();
+    benchmark_backends();
+    benchmark_storage();
+    benchmark_atan2_lut();
+    benchmark_rotor();
+    benchmark_lidar();
+    benchmark_foc();
+    benchmark_observer();
+    benchmark_odometry();
+    benchmark_kinematics();
+    benchmark_mixer();
     
     std::cout << "\nAll examples completed successfully!\n";
     return 0;
@@ -0,0 +1,81 @@
+// precision_report.cpp - Accuracy and speed of one IntegerTrig configuration
+//
+// Built once per table size and interpolation by `make precision-test`:
+//   -DTABLE_SIZE=<8..4096>  -DINTERP=<InterpolateNearest|InterpolateLinear|InterpolateHermite>
+// Prints one row: sine error against <cmath>, scalar and batch ns/op,
+// and table memory.
+
+#include "fast_trig.hpp"
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#ifndef TABLE_SIZE
+#define TABLE_SIZE 128
+#endif
+
+#ifndef INTERP
+#define INTERP InterpolateLinear
+#endif
+
+#define STRINGIFY_(x) #x
+#define STRINGIFY(x) STRINGIFY_(x)
+
+using namespace FastTrig;
+using TrigImpl = IntegerTrig<TABLE_SIZE, AtanDivide, INTERP>;
+
+int main() {
+    // Error over every angle, in output LSB (1/16384)
+    double max_error = 0;
+    double sum_squared = 0;
+    for (int angle = 0; angle < 16384; ++angle) {
+        double expected = 16384.0 * std::sin(2.0 * M_PI * angle / 16384.0);
+        double error = std::abs(TrigImpl::sin(static_cast<uint16_t>(angle)) - expected);
+        max_error = std::max(max_error, error);
+        sum_squared += error * error;
+    }
+    double rms_error = std::sqrt(sum_squared / 16384.0);
+
+    // Scattered angles so the table access pattern is not sequential
+    std::vector<uint16_t> angles(4096);
+    std::vector<int16_t> values(angles.size());
+    uint32_t seed = 12345;
+    for (auto& a : angles) {
+        seed = seed * 1664525u + 1013904223u;
+        a = static_cast<uint16_t>(seed >> 18);
+    }
+
+    const int rounds = 256;
+    const double ops = double(rounds) * angles.size();
+    volatile int32_t sink = 0;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        int32_t acc = 0;
+        for (uint16_t a : angles) {
+            acc += TrigImpl::sin(a);
+        }
+        sink = acc;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double scalar_ns = std::chrono::duration<double, std::nano>(end - start).count() / ops;
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        TrigImpl::sin_batch(angles, values);
+        sink = values[r & 0xFFF];
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double batch_ns = std::chrono::duration<double, std::nano>(end - start).count() / ops;
+    (void)sink;
+
+    std::cout << std::setw(5) << TABLE_SIZE << "  " << std::left << std::setw(20) << STRINGIFY(INTERP)
+              << std::right << std::fixed << std::setprecision(3)
+              << std::setw(9) << max_error << std::setw(9) << rms_error
+              << std::setprecision(2) << std::setw(9) << scalar_ns << std::setw(9) << batch_ns
+              << std::setw(8) << TrigImpl::table_memory() << "\n";
+
+    return 0;
+}
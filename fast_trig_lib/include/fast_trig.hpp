@@ -11,19 +11,267 @@
 #define FAST_TRIG_HPP
 
 #include <cstdint>
+#include <cstring>
 #include <array>
+#include <algorithm>
 #include <concepts>
+#include <span>
+
+#include "fast_trig_fixed.hpp"
+#include "fast_trig_angle.hpp"
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
 
 namespace FastTrig {
 
+namespace detail {
+
+// ============================================================
+// Compile-time reference functions used for table generation
+// ============================================================
+
+// π in Q30
+inline constexpr int64_t PI_Q30 = 3373259426LL;
+
+// Sine of a first-quadrant angle, evaluated by Taylor series in Q30.
+// Input: angle in 1/256 units of the 16384-per-turn scale (0 .. 4096 << 8)
+// Output: sine in Q30
+constexpr int64_t sin_q30(int64_t angle_q8) {
+    int64_t x = (angle_q8 * PI_Q30) >> 21;
+    int64_t x2 = (x * x) >> 30;
+    int64_t term = x;
+    int64_t sum = x;
+    for (int k = 1; k <= 10; ++k) {
+        term = -((term * x2) >> 30) / ((2 * k) * (2 * k + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+// Arctangent of num/den for 0 <= num <= den, evaluated in Q30.
+// Output: angle in 1/256 units of the 16384-per-turn scale (0 .. 2048 << 8)
+constexpr int64_t atan_q8(int64_t num, int64_t den) {
+    // Keep |t| <= tan(π/8) so the series converges quickly; above that use
+    // atan(r) = π/4 + atan((r - 1) / (r + 1))
+    bool reduce = num * 5 > den * 2;
+    int64_t t = reduce ? ((num - den) << 30) / (num + den) : (num << 30) / den;
+    int64_t t2 = (t * t) >> 30;
+    int64_t term = t;
+    int64_t sum = t;
+    for (int k = 1; k <= 14; ++k) {
+        term = -((term * t2) >> 30);
+        sum += term / (2 * k + 1);
+    }
+    // Radians (Q30) to 1/256 angle units: π = 8192 << 8
+    int64_t angle = ((sum << 21) + (sum < 0 ? -(PI_Q30 >> 1) : (PI_Q30 >> 1))) / PI_Q30;
+    return reduce ? (2048 << 8) + angle : angle;
+}
+
+// Seed for the Newton-Raphson reciprocal: 2^32 / d at the midpoint of each
+// of 64 intervals of a normalised divisor d in [2^15, 2^16), minus 2^16
+inline constexpr std::array<uint16_t, 64> reciprocal_seed_table = [] {
+    std::array<uint16_t, 64> table{};
+    for (std::size_t i = 0; i < table.size(); ++i) {
+        uint64_t mid = (uint64_t(64 + i) << 9) + (1 << 8);
+        table[i] = static_cast<uint16_t>((uint64_t(1) << 32) / mid - (1 << 16));
+    }
+    return table;
+}();
+
+// 2^32 / d for d in [2^15, 2^16), rounded up by less than 2^-13 relative
+// One Newton step from the seed, 32-bit multiplies only.
+constexpr uint32_t reciprocal_q32(uint32_t d) noexcept {
+    uint32_t r = reciprocal_seed_table[(d >> 9) & 63] + (1 << 16);
+    // r += r * (2^32 - d * r) / 2^32; the error term wraps correctly mod 2^32
+    int32_t error = static_cast<int32_t>(0u - d * r);
+    r += static_cast<uint32_t>((int32_t(r >> 1) * (error >> 10)) >> 21);
+    // Newton converges from below (by at most 9); bias to an upper bound so
+    // that num == den yields the exact end of the table
+    return r + 9;
+}
+
+// CORDIC rotation angles atan(2^-i) in 1/256 angle units
+inline constexpr int CORDIC_ITERATIONS = 14;
+inline constexpr std::array<int32_t, CORDIC_ITERATIONS> cordic_angle_table = [] {
+    std::array<int32_t, CORDIC_ITERATIONS> table{};
+    for (int i = 0; i < CORDIC_ITERATIONS; ++i) {
+        table[i] = static_cast<int32_t>(atan_q8(1, int64_t(1) << i));
+    }
+    return table;
+}();
+
+// Map a first-quadrant angle (16384 per turn) back to the quadrant of the
+// original (x, y); quadrant_adjust = (x < 0) << 1 | (y < 0)
+// Arithmetic, no table reads: negate when exactly one of x, y is negative,
+// then add π when x is negative (2π wraps to 0).
+constexpr uint16_t unfold_quadrant(uint16_t angle, uint8_t quadrant_adjust) noexcept {
+    uint32_t negate = -static_cast<uint32_t>((quadrant_adjust ^ (quadrant_adjust >> 1)) & 1);
+    uint32_t offset = static_cast<uint32_t>(quadrant_adjust >> 1) << 13;
+    return static_cast<uint16_t>((offset + ((angle ^ negate) - negate)) & 0x3FFF);
+}
+
+// floor(sqrt(value)), bit by bit; no table, no division. Branch-free
+// inside the loop, which starts at the highest set bit pair.
+constexpr uint32_t isqrt32(uint32_t value) noexcept {
+    if (value == 0) {
+        return 0;
+    }
+    uint32_t root = 0;
+    uint32_t bit = 1u << ((31 - __builtin_clz(value)) & ~1);
+    while (bit != 0) {
+        uint32_t trial = root + bit;
+        uint32_t take = -static_cast<uint32_t>(value >= trial);
+        value -= trial & take;
+        root = (root >> 1) + (bit & take);
+        bit >>= 2;
+    }
+    return root;
+}
+
+// x · p(x²) for an odd polynomial with Q15 coefficients, lowest power
+// first; x in Q15, |x| <= 1, result Q30. Every product stays below 2^31.
+template<std::size_t N>
+constexpr int32_t odd_polynomial(const std::array<int32_t, N>& coeffs, int32_t x) noexcept {
+    int32_t x2 = (x * x) >> 15;
+    int32_t acc = coeffs[N - 1];
+    for (std::size_t k = N - 1; k-- > 0;) {
+        acc = coeffs[k] + ((acc * x2 + (1 << 14)) >> 15);
+    }
+    return acc * x;
+}
+
+// atan(t) / (π/4) for t in [0, 1], degree 9 (Remez, absolute error),
+// within 0.7 angle units
+inline constexpr std::array<int32_t, 5> atan_minimax_q15 = {41721, -13868, 7852, -3999, 1063};
+
+// Double-precision series for the Q31 tables of IntegerTrig32; evaluated at
+// compile time only, so no FPU or libm is needed on the target
+inline constexpr double PI_DOUBLE = 3.14159265358979323846;
+
+// sin(x) for |x| <= π/2
+constexpr double sin_series(double x) {
+    double x2 = x * x;
+    double term = x;
+    double sum = x;
+    for (int k = 1; k <= 14; ++k) {
+        term = -term * x2 / ((2 * k) * (2 * k + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+// atan(x) for 0 <= x <= 1, with the same π/4 reduction as atan_q8
+constexpr double atan_series(double x) {
+    bool reduce = x * 5 > 2;
+    double t = reduce ? (x - 1) / (x + 1) : x;
+    double t2 = t * t;
+    double term = t;
+    double sum = t;
+    for (int k = 1; k <= 30; ++k) {
+        term = -term * t2;
+        sum += term / (2 * k + 1);
+    }
+    return reduce ? PI_DOUBLE / 4 + sum : sum;
+}
+
+} // namespace detail
+
+// ============================================================
+// atan2 policies
+// ============================================================
+
+// Table lookup on min/max, one integer division (default)
+struct AtanDivide {};
+
+// Table lookup on min/max, the ratio taken from a CLZ-normalised divisor
+// and a seeded Newton-Raphson reciprocal; no division
+struct AtanReciprocal {};
+
+// Vectoring CORDIC, shift-and-add only; no table or division
+struct AtanCordic {};
+
+template<typename P>
+concept AtanPolicy = std::same_as<P, AtanDivide> || std::same_as<P, AtanReciprocal> ||
+                     std::same_as<P, AtanCordic>;
+
+// ============================================================
+// magnitude methods
+// ============================================================
+
+// 12-iteration CORDIC on inputs normalised to bit 28, error below 0.001%
+// plus 1 LSB (default)
+struct MagnitudeCordic {};
+
+// max(α1·max + β1·min, α2·max + β2·min) over |x|, |y|; error below 1% plus
+// 2 LSB, two multiply-adds and no loop
+struct MagnitudeAlphaBeta {};
+
+template<typename M>
+concept MagnitudeMethod = std::same_as<M, MagnitudeCordic> || std::same_as<M, MagnitudeAlphaBeta>;
+
+// ============================================================
+// Sine table interpolation
+// ============================================================
+
+// Closest table entry, no multiply
+struct InterpolateNearest {};
+
+// Straight line between adjacent entries, 8-bit fraction (default)
+struct InterpolateLinear {};
+
+// Cubic Hermite between adjacent entries using a second table of
+// derivatives, 15-bit fraction; table error drops by roughly 16x per
+// doubling of TableSize instead of 4x
+struct InterpolateHermite {};
+
+template<typename I>
+concept Interpolation = std::same_as<I, InterpolateNearest> || std::same_as<I, InterpolateLinear> ||
+                        std::same_as<I, InterpolateHermite>;
+
+// ============================================================
+// Sine table layout
+// ============================================================
+
+// int16 values; linear interpolation reads two adjacent entries (default)
+struct LayoutSplit {};
+
+// One 32-bit word per entry holding {value, next - value}: one aligned load
+// per lookup and no subtraction, for twice the sine table size. Linear
+// interpolation only.
+struct LayoutInterleaved {};
+
+template<typename L>
+concept TableLayout = std::same_as<L, LayoutSplit> || std::same_as<L, LayoutInterleaved>;
+
+// ============================================================
+// Table storage
+// ============================================================
+
+// Sine, atan and asin quarter tables (default)
+struct MemoryFull {};
+
+// Sine quarter table only, about a third of the memory. asin/acos invert
+// the sine table by binary search and interpolation (plus an isqrt above
+// 1/2); atan evaluates a degree-9 minimax polynomial on the ratio the
+// AtanPolicy computes.
+struct MemoryMinimal {};
+
+template<typename S>
+concept StoragePolicy = std::same_as<S, MemoryFull> || std::same_as<S, MemoryMinimal>;
+
 // Configuration options
-template<std::size_t TableSize = 128>
-requires (TableSize >= 8 && TableSize <= 4096 && (TableSize & (TableSize - 1)) == 0)
+template<std::size_t TableSize = 128, AtanPolicy Atan = AtanDivide,
+         Interpolation Interp = InterpolateLinear, TableLayout Layout = LayoutSplit,
+         StoragePolicy Storage = MemoryFull>
+requires (TableSize >= 8 && TableSize <= 4096 && (TableSize & (TableSize - 1)) == 0) &&
+         (std::same_as<Layout, LayoutSplit> || std::same_as<Interp, InterpolateLinear>)
 class IntegerTrig {
 public:
     // Constants
-    static constexpr uint16_t ANGLE_MAX = 8192;      // 2π in angle units
-    static constexpr int16_t OUTPUT_SCALE = 8192;    // ±16384 for ±2.0 output range
+    static constexpr uint16_t ANGLE_MAX = 8192;      // π in angle units (a turn is 16384)
+    static constexpr int16_t OUTPUT_SCALE = 8192;    // tan() scale; sin/cos use ±16384 for ±1.0
     
     // ============================================================
     // Core trigonometric functions
@@ -31,7 +279,7 @@ public:
     
     // Sine function
     // Input: angle in units where 0-16384 represents 0-2π
-    // Output: sine value scaled by ±16384 (±2.0)
+    // Output: sine value scaled by ±16384 (±1.0)
     [[nodiscard]] 
     static constexpr int16_t sin(uint16_t angle) noexcept {
         angle &= 0x3FFF;  // Fast modulo using bit mask
@@ -43,16 +291,7 @@ public:
             position = 0x1000 - position;
         }
         
-        uint32_t index_scaled = position * RECIPROCAL_QUADRANT;
-        uint32_t index = index_scaled >> 16;
-        uint8_t fraction = (index_scaled >> 8) & 0xFF;
-        
-        index = (index < TableSize - 1) ? index : (TableSize - 1);
-        
-        int32_t y0 = sine_quarter_table[index];
-        int32_t y1 = sine_quarter_table[(index + 1) & TABLE_MASK];
-        
-        int16_t value = static_cast<int16_t>(y0 + (((y1 - y0) * fraction) >> 8));
+        int16_t value = quarter_lookup(position * RECIPROCAL_QUADRANT);
         
         // Branchless conditional negate
         int16_t sign_mask = -(quadrant >> 1);
@@ -62,7 +301,7 @@ public:
     // Cosine function
     [[nodiscard]] 
     static constexpr int16_t cos(uint16_t angle) noexcept {
-        return sin(angle + (ANGLE_MAX >> 2));
+        return sin(angle + (ANGLE_MAX >> 1));
     }
     
     // Tangent function
@@ -88,50 +327,36 @@ public:
     // ============================================================
     
     // Arctangent of y/x, returns angle in standard units
+    // Branch-free octant folding: signs and the |y| > |x| swap become masks,
+    // the first-octant angle is reflected and negated arithmetically, so
+    // random input directions cost no mispredictions. atan2(0, 0) = 0.
     [[nodiscard]] 
     static uint16_t atan2(int16_t y, int16_t x) noexcept {
-        if (x == 0) {
-            if (y > 0) return ANGLE_MAX >> 1;
-            if (y < 0) return (ANGLE_MAX >> 1) * 3;
-            return 0;
-        }
+        int32_t sign_x = x >> 15;
+        int32_t sign_y = y >> 15;
+        uint32_t abs_x = static_cast<uint32_t>((x ^ sign_x) - sign_x);
+        uint32_t abs_y = static_cast<uint32_t>((y ^ sign_y) - sign_y);
         
-        uint32_t abs_x = (x < 0) ? -x : x;
-        uint32_t abs_y = (y < 0) ? -y : y;
-        uint8_t quadrant_adjust = ((x < 0) << 1) | (y < 0);
-        
-        uint16_t angle;
+        // Fold into the first octant: major >= minor
+        uint32_t steep = -static_cast<uint32_t>(abs_y > abs_x);
+        uint32_t swap = (abs_x ^ abs_y) & steep;
+        uint32_t major = abs_x ^ swap;
+        uint32_t minor = abs_y ^ swap;
+        major |= (major == 0);  // atan2(0, 0): 0 / 1
         
-        if (abs_x >= abs_y) {
-            uint32_t ratio_scaled = (abs_y << TABLE_BITS) / abs_x;
-            uint32_t index = ratio_scaled & TABLE_MASK;
-            uint32_t fraction = ((abs_y << (TABLE_BITS + 8)) / abs_x) & 0xFF;
-            
-            int32_t y0 = atan_quarter_table[index];
-            int32_t y1 = atan_quarter_table[(index + 1) & TABLE_MASK];
-            
-            angle = static_cast<uint16_t>(y0 + (((y1 - y0) * fraction) >> 8));
+        uint32_t angle;
+        if constexpr (std::same_as<Atan, AtanCordic>) {
+            // Exact on the axes, like the table policies
+            angle = cordic_angle(major, minor) & -static_cast<uint32_t>(minor != 0);
         } else {
-            uint32_t ratio_scaled = (abs_x << TABLE_BITS) / abs_y;
-            uint32_t index = ratio_scaled & TABLE_MASK;
-            uint32_t fraction = ((abs_x << (TABLE_BITS + 8)) / abs_y) & 0xFF;
-            
-            int32_t y0 = atan_quarter_table[index];
-            int32_t y1 = atan_quarter_table[(index + 1) & TABLE_MASK];
-            
-            uint16_t base = static_cast<uint16_t>(y0 + (((y1 - y0) * fraction) >> 8));
-            angle = (ANGLE_MAX >> 1) - base;
+            angle = atan_ratio(minor, major);
         }
         
-        static constexpr uint16_t quadrant_offset[4] = {
-            0, 2 * ANGLE_MAX, ANGLE_MAX, ANGLE_MAX
-        };
-        
-        static constexpr int16_t angle_sign[4] = {
-            1, -1, -1, 1
-        };
+        // Steep octants: π/2 - angle
+        angle = ((angle ^ steep) - steep + ((ANGLE_MAX >> 1) & steep));
         
-        return quadrant_offset[quadrant_adjust] + (angle * angle_sign[quadrant_adjust]);
+        uint8_t quadrant_adjust = static_cast<uint8_t>((sign_x & 2) | (sign_y & 1));
+        return detail::unfold_quadrant(static_cast<uint16_t>(angle), quadrant_adjust);
     }
     
     // Single-argument arctangent
@@ -141,22 +366,25 @@ public:
     }
     
     // Arcsine function
-    // Input: value scaled by ±8192 for ±1.0
+    // Input: value scaled by ±16384 for ±1.0
     [[nodiscard]] 
     static uint16_t asin(int16_t value) noexcept {
         uint32_t abs_val = (value < 0) ? -value : value;
         abs_val = (abs_val > OUTPUT_SCALE * 2) ? OUTPUT_SCALE * 2 : abs_val;
         
+        if constexpr (std::same_as<Storage, MemoryMinimal>) {
+            uint16_t angle = inverse_sine(abs_val);
+            return (value < 0) ? (2 * ANGLE_MAX - angle) : angle;
+        }
+        
         constexpr uint32_t ASIN_RECIPROCAL = (TableSize << 16) / (OUTPUT_SCALE * 2);
         
         uint32_t index_scaled = abs_val * ASIN_RECIPROCAL;
         uint32_t index = index_scaled >> 16;
         uint8_t fraction = (index_scaled >> 8) & 0xFF;
         
-        index = (index < TableSize - 1) ? index : (TableSize - 1);
-        
-        int32_t y0 = asin_quarter_table[index];
-        int32_t y1 = asin_quarter_table[(index + 1) & TABLE_MASK];
+        int32_t y0 = asin_entry(index);
+        int32_t y1 = asin_entry(index + 1);
         
         uint16_t angle = static_cast<uint16_t>(y0 + (((y1 - y0) * fraction) >> 8));
         
@@ -167,43 +395,251 @@ public:
     [[nodiscard]] 
     static uint16_t acos(int16_t value) noexcept {
         uint16_t asin_result = asin(value);
-        return (ANGLE_MAX >> 1) - asin_result;
+        return ((ANGLE_MAX >> 1) - asin_result) & 0x3FFF;
     }
     
     // ============================================================
     // Utility functions
     // ============================================================
     
-    // CORDIC magnitude calculation (Pythagorean distance)
+    // Magnitude calculation (Pythagorean distance), no square root needed
+    // Results are exact-width while sqrt(x² + y²) fits in int32
+    template<MagnitudeMethod Method = MagnitudeCordic>
     [[nodiscard]] 
     static int32_t magnitude(int32_t x, int32_t y) noexcept {
-        uint32_t abs_x = (x < 0) ? -x : x;
-        uint32_t abs_y = (y < 0) ? -y : y;
+        int64_t abs_x = (x < 0) ? -int64_t(x) : x;
+        int64_t abs_y = (y < 0) ? -int64_t(y) : y;
         
-        for (int i = 0; i < 12; ++i) {
-            uint32_t x_shift = abs_x >> i;
-            uint32_t y_shift = abs_y >> i;
+        if constexpr (std::same_as<Method, MagnitudeAlphaBeta>) {
+            int64_t hi = (abs_x > abs_y) ? abs_x : abs_y;
+            int64_t lo = (abs_x > abs_y) ? abs_y : abs_x;
+            int64_t near_axis = ((hi * MAG_ALPHA1) >> 15) + ((lo * MAG_BETA1) >> 15);
+            int64_t near_diagonal = ((hi * MAG_ALPHA2) >> 15) + ((lo * MAG_BETA2) >> 15);
+            return static_cast<int32_t>((near_axis > near_diagonal) ? near_axis : near_diagonal);
+        } else {
+            if ((abs_x | abs_y) == 0) return 0;
             
-            if (abs_y > 0) {
-                uint32_t x_new = abs_x + y_shift;
-                uint32_t y_new = (abs_y > x_shift) ? abs_y - x_shift : 0;
-                abs_x = x_new;
-                abs_y = y_new;
+            // Bring the larger input to bit 28, as in to_polar(), so the
+            // truncating shifts below do not swamp small vectors
+            int shift = __builtin_clzll(static_cast<uint64_t>(abs_x | abs_y)) - 35;
+            int64_t cx = (shift >= 0) ? abs_x << shift : abs_x >> -shift;
+            int64_t cy = (shift >= 0) ? abs_y << shift : abs_y >> -shift;
+            
+            // Vectoring mode: rotate (x, y) onto the positive x axis; d is 0
+            // when rotating clockwise (y >= 0), -1 otherwise
+            for (int i = 0; i < 12; ++i) {
+                int64_t d = cy >> 63;
+                int64_t x_shift = cx >> i;
+                int64_t y_shift = cy >> i;
+                
+                cx += (y_shift ^ d) - d;
+                cy -= (x_shift ^ d) - d;
             }
+            
+            // Remove CORDIC gain (1/1.64676 = 39797/65536), then undo the
+            // normalisation with rounding
+            int64_t scaled = (cx * 39797) >> 16;
+            int64_t magnitude = (shift >= 0)
+                ? (scaled + ((int64_t(1) << shift) >> 1)) >> shift
+                : scaled << -shift;
+            return static_cast<int32_t>((magnitude > INT32_MAX) ? INT32_MAX : magnitude);
+        }
+    }
+    
+    // Angle and magnitude from one vectoring CORDIC pass
+    struct Polar {
+        uint16_t angle;     // 0-16384 (0-2π)
+        int32_t magnitude;  // sqrt(x² + y²), gain corrected
+    };
+    
+    // Cheaper than atan2() + magnitude(): the rotation that drives y to zero
+    // is the angle, the rotated x is the magnitude. Any int32 input range.
+    [[nodiscard]] 
+    static Polar to_polar(int32_t x, int32_t y) noexcept {
+        if ((x | y) == 0) return {0, 0};
+        
+        uint32_t abs_x = (x < 0) ? 0u - uint32_t(x) : uint32_t(x);
+        uint32_t abs_y = (y < 0) ? 0u - uint32_t(y) : uint32_t(y);
+        uint8_t quadrant_adjust = ((x < 0) << 1) | (y < 0);
+        
+        // Bring the larger input to bit 28, as in cordic_angle()
+        int shift = __builtin_clz(abs_x | abs_y) - 3;
+        int32_t cx, cy;
+        if (shift >= 0) {
+            cx = static_cast<int32_t>(abs_x << shift);
+            cy = static_cast<int32_t>(abs_y << shift);
+        } else {
+            cx = static_cast<int32_t>(abs_x >> -shift);
+            cy = static_cast<int32_t>(abs_y >> -shift);
         }
         
-        return (abs_x * 39797) >> 16;
+        int32_t angle_q8 = cordic_rotate(cx, cy);
+        uint16_t angle = static_cast<uint16_t>((angle_q8 + 128) >> 8);
+        
+        // Remove the CORDIC gain, then undo the normalisation with rounding
+        int64_t scaled = (int64_t(cx) * CORDIC_GAIN_INV_Q30) >> 30;
+        int64_t magnitude = (shift >= 0)
+            ? (scaled + ((int64_t(1) << shift) >> 1)) >> shift
+            : scaled << -shift;
+        magnitude = (magnitude > INT32_MAX) ? INT32_MAX : magnitude;
+        
+        return {detail::unfold_quadrant(angle, quadrant_adjust), static_cast<int32_t>(magnitude)};
     }
     
     // Simultaneous sine and cosine calculation
-    static void sincos(uint16_t angle, int16_t& sin_out, int16_t& cos_out) noexcept {
-        sin_out = sin(angle);
-        cos_out = cos(angle);
+    // Decodes the quadrant once; cos reads the mirrored position of the
+    // same quarter table. Bit-exact with sin() and cos().
+    static constexpr void sincos(uint16_t angle, int16_t& sin_out, int16_t& cos_out) noexcept {
+        angle &= 0x3FFF;
+        
+        uint8_t quadrant = angle >> 12;
+        uint16_t position = angle & 0xFFF;
+        
+        if (quadrant & 1) {
+            position = 0x1000 - position;
+        }
+        
+        // cos(angle) = sin(angle + π/2): next quadrant, complementary position
+        uint32_t sin_scaled = position * RECIPROCAL_QUADRANT;
+        uint32_t cos_scaled = QUARTER_SCALED - sin_scaled;
+        
+        int16_t sin_value = quarter_lookup(sin_scaled);
+        int16_t cos_value = quarter_lookup(cos_scaled);
+        
+        int16_t sin_mask = -(quadrant >> 1);
+        int16_t cos_mask = -((quadrant ^ (quadrant >> 1)) & 1);
+        sin_out = (sin_value ^ sin_mask) - sin_mask;
+        cos_out = (cos_value ^ cos_mask) - cos_mask;
+    }
+    
+    // sin/cos as Q1.14 fixed point; the same bits as the int16_t versions
+    [[nodiscard]] 
+    static constexpr Q14 sin_fixed(uint16_t angle) noexcept {
+        return Q14::from_raw(sin(angle));
+    }
+    
+    [[nodiscard]] 
+    static constexpr Q14 cos_fixed(uint16_t angle) noexcept {
+        return Q14::from_raw(cos(angle));
+    }
+    
+    static constexpr void sincos(uint16_t angle, Q14& sin_out, Q14& cos_out) noexcept {
+        int16_t sin_value, cos_value;
+        sincos(angle, sin_value, cos_value);
+        sin_out = Q14::from_raw(sin_value);
+        cos_out = Q14::from_raw(cos_value);
+    }
+
+    // Typed angles. Degrees, Milliradians and coarser binary angles convert
+    // to Angle14 implicitly; finer ones (Angle16, Angle32) need angle_cast.
+    [[nodiscard]] 
+    static constexpr int16_t sin(Angle14 angle) noexcept { return sin(angle.raw()); }
+    
+    [[nodiscard]] 
+    static constexpr int16_t cos(Angle14 angle) noexcept { return cos(angle.raw()); }
+    
+    static constexpr void sincos(Angle14 angle, Q14& sin_out, Q14& cos_out) noexcept {
+        sincos(angle.raw(), sin_out, cos_out);
+    }
+    
+    // atan2 as a typed angle of any width, e.g. atan2<16>(y, x)
+    template<int TurnBits>
+    [[nodiscard]] 
+    static Angle<TurnBits> atan2(int16_t y, int16_t x) noexcept {
+        return angle_cast<Angle<TurnBits>, RoundNearest>(Angle14::from_raw(atan2(y, x)));
+    }
+    
+    // ============================================================
+    // Batch functions
+    // ============================================================
+    
+    // Sine over an array of angles, bit-exact with sin()
+    // Processes min(angles.size(), out.size()) elements
+    static void sin_batch(std::span<const uint16_t> angles, std::span<int16_t> out) noexcept {
+        sin_batch_offset(angles, out, 0);
+    }
+    
+    // Cosine over an array of angles, bit-exact with cos()
+    static void cos_batch(std::span<const uint16_t> angles, std::span<int16_t> out) noexcept {
+        sin_batch_offset(angles, out, ANGLE_MAX >> 1);
+    }
+    
+    // Sine and cosine over an array of angles, bit-exact with sincos()
+    static void sincos_batch(std::span<const uint16_t> angles,
+                             std::span<int16_t> sin_out, std::span<int16_t> cos_out) noexcept {
+        const uint16_t* in = angles.data();
+        int16_t* sin_dst = sin_out.data();
+        int16_t* cos_dst = cos_out.data();
+        std::size_t count = std::min({angles.size(), sin_out.size(), cos_out.size()});
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        i = count & ~std::size_t(7);
+        sincos_batch_avx2(in, sin_dst, cos_dst, i);
+#elif defined(__SSE4_1__)
+        if constexpr (std::same_as<Interp, InterpolateLinear>) {
+            i = count & ~std::size_t(3);
+            sincos_batch_sse41(in, sin_dst, cos_dst, i);
+        }
+#endif
+        for (; i < count; ++i) {
+            sincos(in[i], sin_dst[i], cos_dst[i]);
+        }
+    }
+    
+    // Magnitude over SoA arrays of x and y, bit-exact with magnitude<Method>()
+    // Processes min(xs.size(), ys.size(), out.size()) elements
+    template<MagnitudeMethod Method = MagnitudeCordic>
+    static void magnitude_batch(std::span<const int32_t> xs, std::span<const int32_t> ys,
+                                std::span<int32_t> out) noexcept {
+        const int32_t* px = xs.data();
+        const int32_t* py = ys.data();
+        int32_t* dst = out.data();
+        std::size_t count = std::min({xs.size(), ys.size(), out.size()});
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        i = count & ~std::size_t(7);
+        magnitude_batch_avx2<Method>(px, py, dst, i);
+#endif
+        for (; i < count; ++i) {
+            dst[i] = magnitude<Method>(px[i], py[i]);
+        }
+    }
+    
+    // to_polar over SoA int16 coordinates, bit-exact with to_polar()
+    // Processes the shortest of the four spans
+    static void to_polar_batch(std::span<const int16_t> xs, std::span<const int16_t> ys,
+                               std::span<uint16_t> angles, std::span<int32_t> magnitudes) noexcept {
+        std::size_t count = std::min({xs.size(), ys.size(), angles.size(), magnitudes.size()});
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        i = count & ~std::size_t(7);
+        to_polar_batch_avx2(xs.data(), ys.data(), angles.data(), magnitudes.data(), i);
+#endif
+        for (; i < count; ++i) {
+            Polar polar = to_polar(xs[i], ys[i]);
+            angles[i] = polar.angle;
+            magnitudes[i] = polar.magnitude;
+        }
     }
     
     // Get memory usage information
     static constexpr std::size_t table_memory() { 
-        return sizeof(sine_quarter_table) + sizeof(atan_quarter_table) + sizeof(asin_quarter_table); 
+        std::size_t policy_tables = 0;
+        if constexpr (std::same_as<Atan, AtanReciprocal>) {
+            policy_tables = sizeof(detail::reciprocal_seed_table);
+        } else if constexpr (std::same_as<Atan, AtanCordic>) {
+            policy_tables = sizeof(detail::cordic_angle_table);
+        }
+        if constexpr (std::same_as<Interp, InterpolateHermite>) {
+            policy_tables += sizeof(sine_slope_table);
+        }
+        // The interleaved layout replaces the sine table
+        std::size_t sine_table = std::same_as<Layout, LayoutInterleaved> ? sizeof(sine_pair_table)
+                                                                        : sizeof(sine_quarter_table);
+        if constexpr (std::same_as<Storage, MemoryMinimal>) {
+            return sine_table + policy_tables;
+        }
+        return sine_table + sizeof(atan_quarter_table) + sizeof(asin_quarter_table) + policy_tables;
     }
     
     static constexpr std::size_t table_size() { return TableSize; }
@@ -212,158 +648,1597 @@ private:
     // Precomputed constants for optimization
     static constexpr int TABLE_BITS = __builtin_ctz(TableSize);
     static constexpr uint32_t TABLE_MASK = TableSize - 1;
-    static constexpr uint32_t RECIPROCAL_QUADRANT = (TableSize << 16) / 4096;
+    static constexpr uint32_t RECIPROCAL_QUADRANT = ((TableSize - 1) << 16) / 4096;
+    static constexpr uint32_t QUARTER_SCALED = 0x1000 * RECIPROCAL_QUADRANT;
     
-    // Table generation for sine (quarter wave)
-    static constexpr int16_t sin_internal(uint32_t angle) {
-        uint32_t x = angle;
-        uint32_t term = (x * (16384 - x)) >> 14;
-        int32_t numerator = term << 2;
-        int32_t denominator = 16487 - term;
-        if (denominator == 0) return OUTPUT_SCALE * 2;
-        return static_cast<int16_t>((numerator * OUTPUT_SCALE * 2) / denominator);
+    // Interpolated quarter-wave sine at a 16.16 table position
+    static constexpr int16_t quarter_lookup(uint32_t index_scaled) noexcept {
+        if constexpr (std::same_as<Interp, InterpolateNearest>) {
+            return sine_quarter_table[(index_scaled + 0x8000) >> 16];
+        } else if constexpr (std::same_as<Interp, InterpolateHermite>) {
+            uint32_t index = index_scaled >> 16;
+            int32_t t = (index_scaled & 0xFFFF) >> 1;
+            uint32_t next = (index + 1) & TABLE_MASK;
+            return hermite(sine_quarter_table[index], sine_quarter_table[next],
+                           sine_slope_table[index], sine_slope_table[next], t);
+        } else if constexpr (std::same_as<Layout, LayoutInterleaved>) {
+            uint32_t entry = sine_pair_table[index_scaled >> 16];
+            int32_t fraction = (index_scaled >> 8) & 0xFF;
+            
+            int32_t y0 = static_cast<int16_t>(entry);
+            int32_t delta = static_cast<int32_t>(entry) >> 16;
+            
+            return static_cast<int16_t>(y0 + ((delta * fraction) >> 8));
+        } else {
+            uint32_t index = index_scaled >> 16;
+            uint8_t fraction = (index_scaled >> 8) & 0xFF;
+            
+            int32_t y0 = sine_quarter_table[index];
+            int32_t y1 = sine_quarter_table[(index + 1) & TABLE_MASK];
+            
+            return static_cast<int16_t>(y0 + (((y1 - y0) * fraction) >> 8));
+        }
     }
     
-    static constexpr std::array<int16_t, TableSize> generate_sine_quarter_table() {
-        std::array<int16_t, TableSize> table{};
-        for (std::size_t i = 0; i < TableSize; ++i) {
-            uint32_t angle = (i * 16384) / (TableSize - 1);
-            table[i] = sin_internal(angle);
-        }
-        return table;
+    // Cubic Hermite on one table interval in Horner form; slopes are per
+    // interval, t is Q15 in [0, 32768]. t = 32768 gives y1 exactly.
+    static constexpr int16_t hermite(int32_t y0, int32_t y1, int32_t m0, int32_t m1, int32_t t) noexcept {
+        int32_t c2 = 3 * (y1 - y0) - 2 * m0 - m1;
+        int32_t c3 = 2 * (y0 - y1) + m0 + m1;
+        int32_t acc = c2 + ((c3 * t + (1 << 14)) >> 15);
+        acc = m0 + ((acc * t + (1 << 14)) >> 15);
+        return static_cast<int16_t>(y0 + ((acc * t + (1 << 14)) >> 15));
     }
     
-    // Table generation for atan (quarter range)
-    static constexpr std::array<uint16_t, TableSize> generate_atan_quarter_table() {
-        std::array<uint16_t, TableSize> table{};
-        for (std::size_t i = 0; i < TableSize; ++i) {
-            int32_t x = 16384;
-            int32_t y = 0;
-            int32_t target_y = (i * 16384) / TableSize;
-            uint32_t angle = 0;
-            
-            for (int k = 0; k < 16; ++k) {
-                int32_t x_new, y_new;
-                uint32_t angle_step = (2048 >> k);
-                
-                if (y < target_y) {
-                    x_new = x - (y >> k);
-                    y_new = y + (x >> k);
-                    angle += angle_step;
-                } else {
-                    x_new = x + (y >> k);
-                    y_new = y - (x >> k);
-                    angle -= angle_step;
-                }
-                x = x_new;
-                y = y_new;
-            }
+    // Angle of π/4 and π/2, the end points of the atan and asin tables
+    static constexpr uint16_t ATAN_END = ANGLE_MAX >> 2;
+    static constexpr uint16_t ASIN_END = ANGLE_MAX >> 1;
+    
+    // Interpolated atan(num / den) for num <= den, in angle units (0 .. π/4)
+    static uint16_t atan_ratio(uint32_t num, uint32_t den) noexcept {
+        if constexpr (std::same_as<Storage, MemoryMinimal>) {
+            int32_t t = static_cast<int32_t>(std::same_as<Atan, AtanReciprocal> ? reciprocal_ratio<15>(num, den)
+                                                                               : (num << 15) / den);
+            return static_cast<uint16_t>((detail::odd_polynomial(detail::atan_minimax_q15, t) + (1 << 18)) >> 19);
+        }
+        
+        uint32_t index;
+        uint32_t fraction;
+        
+        if constexpr (std::same_as<Atan, AtanReciprocal>) {
+            uint32_t ratio = reciprocal_ratio<TABLE_BITS + 8>(num, den);
+            index = ratio >> 8;
+            fraction = ratio & 0xFF;
+        } else {
+            using Wide = std::conditional_t<(TABLE_BITS + 8 + 16 <= 32), uint32_t, uint64_t>;
             
-            table[i] = static_cast<uint16_t>(angle);
+            uint32_t ratio = static_cast<uint32_t>((Wide(num) << (TABLE_BITS + 8)) / den);
+            index = ratio >> 8;
+            fraction = ratio & 0xFF;
         }
-        return table;
+        
+        int32_t y0 = atan_entry(index);
+        int32_t y1 = atan_entry(index + 1);
+        
+        return static_cast<uint16_t>(y0 + (((y1 - y0) * int32_t(fraction)) >> 8));
     }
     
-    // Table generation for asin (quarter range)
-    static constexpr std::array<uint16_t, TableSize> generate_asin_quarter_table() {
-        std::array<uint16_t, TableSize> table{};
-        for (std::size_t i = 0; i < TableSize; ++i) {
-            int32_t target = (i * OUTPUT_SCALE * 2) / TableSize;
-            uint32_t low = 0;
-            uint32_t high = ANGLE_MAX / 2;
-            
-            while (high - low > 1) {
-                uint32_t mid = (low + high) / 2;
-                int32_t sin_mid = sin_internal(mid);
-                
-                if (sin_mid < target) {
-                    low = mid;
-                } else {
-                    high = mid;
-                }
-            }
+    // num / den for num <= den in Q(Bits), clamped to 1.0, without a division
+    template<int Bits>
+    static uint32_t reciprocal_ratio(uint32_t num, uint32_t den) noexcept {
+        // Normalise den to [2^15, 2^16) and scale num alongside
+        int shift = __builtin_clz(den) - 16;
+        uint32_t d = den << shift;
+        uint32_t ratio = ((num << shift) * (detail::reciprocal_q32(d) >> 1)) >> (31 - Bits);
+        return (ratio < (1u << Bits)) ? ratio : (1u << Bits);
+    }
+    
+    // asin for value 0 .. 16384 from the sine table alone, 0 .. 4096.
+    // Below 1/2 the table is inverted directly; above it the sine is too
+    // flat for that, so asin(v) = π/2 - 2·asin(sqrt((1 - v) / 2)) is used.
+    static uint16_t inverse_sine(uint32_t value) noexcept {
+        if (value > 8192) {
+            uint32_t half_chord = (detail::isqrt32((16384 - value) << 15) + 1) >> 1;
+            return static_cast<uint16_t>((ANGLE_MAX >> 1) - 2 * inverse_sine_search(half_chord));
+        }
+        return inverse_sine_search(value);
+    }
+    
+    // Last table entry <= value by branch-free binary search, then linear
+    // interpolation to the table position and on to angle units. value is
+    // at most 1/2 (π/6), so only the first half of the table (up to π/4)
+    // is searched.
+    static uint16_t inverse_sine_search(uint32_t value) noexcept {
+        uint32_t index = 0;
+        for (uint32_t half = TableSize / 4; half > 0; half >>= 1) {
+            index += (sine_entry(index + half) <= int32_t(value)) ? half : 0;
+        }
+        
+        int32_t y0 = sine_entry(index);
+        int32_t y1 = sine_entry(index + 1);
+        uint32_t position = (index << 16) + ((value - y0) << 16) / uint32_t(y1 - y0);
+        return static_cast<uint16_t>((uint64_t(position) * ANGLE_PER_INDEX_Q16 + (1u << 31)) >> 32);
+    }
+    
+    // Angle units per sine table interval, Q16
+    static constexpr uint64_t ANGLE_PER_INDEX_Q16 = ((uint64_t(4096) << 16) + (TableSize - 1) / 2) / (TableSize - 1);
+    
+    // Sine table entry from whichever table the layout keeps
+    static constexpr int32_t sine_entry(uint32_t index) noexcept {
+        if constexpr (std::same_as<Layout, LayoutInterleaved>) {
+            return static_cast<int16_t>(sine_pair_table[index]);
+        } else {
+            return sine_quarter_table[index];
+        }
+    }
+    
+    // First-quadrant atan2 by vectoring CORDIC, in angle units (0 .. π/2)
+    static uint16_t cordic_angle(uint32_t abs_x, uint32_t abs_y) noexcept {
+        // Scale the larger input up to bit 28 for precision; the CORDIC gain
+        // of 1.65 on a diagonal vector then keeps x below 2^31
+        int shift = __builtin_clz(abs_x | abs_y) - 3;
+        int32_t x = static_cast<int32_t>(abs_x << shift);
+        int32_t y = static_cast<int32_t>(abs_y << shift);
+        
+        return static_cast<uint16_t>((cordic_rotate(x, y) + 128) >> 8);
+    }
+    
+    // Vectoring CORDIC core: rotates (x, y), x > 0, onto the x axis and
+    // returns the rotation in 1/256 angle units. x is left scaled by the
+    // CORDIC gain.
+    static int32_t cordic_rotate(int32_t& x, int32_t& y) noexcept {
+        int32_t angle = 0;
+        
+        // Branch-free: d is 0 when rotating clockwise (y >= 0), -1 otherwise
+        for (int i = 0; i < detail::CORDIC_ITERATIONS; ++i) {
+            int32_t d = y >> 31;
+            int32_t x_shift = x >> i;
+            int32_t y_shift = y >> i;
             
-            table[i] = static_cast<uint16_t>((low + high) / 2);
+            x += (y_shift ^ d) - d;
+            y -= (x_shift ^ d) - d;
+            angle += (detail::cordic_angle_table[i] ^ d) - d;
         }
-        return table;
+        
+        return angle;
     }
     
-    // Lookup tables (using quarter-wave/range symmetry)
-    alignas(64) static constexpr auto sine_quarter_table = generate_sine_quarter_table();
-    alignas(64) static constexpr auto atan_quarter_table = generate_atan_quarter_table();
-    alignas(64) static constexpr auto asin_quarter_table = generate_asin_quarter_table();
-};
-
-// Convenient type aliases for common configurations
-using Trig32 = IntegerTrig<32>;    // 96 bytes - Ultra compact
-using Trig64 = IntegerTrig<64>;    // 192 bytes - Compact
-using Trig128 = IntegerTrig<128>;  // 384 bytes - Balanced (recommended)
-using Trig256 = IntegerTrig<256>;  // 768 bytes - High precision
-using Trig512 = IntegerTrig<512>;  // 1536 bytes - Very high precision
-
-// Default configuration
-using Trig = Trig128;
-
-// ============================================================
-// Helper classes for common operations
-// ============================================================
-
-template<typename TrigImpl = Trig>
-class Vector2D {
-public:
-    struct Vec2 {
-        int16_t x, y;
-    };
+    // MagnitudeAlphaBeta coefficients (Q15), fitted for minimax relative error
+    static constexpr int32_t MAG_ALPHA1 = 32454;  // 0.99043
+    static constexpr int32_t MAG_BETA1 = 6436;    // 0.19642
+    static constexpr int32_t MAG_ALPHA2 = 27521;  // 0.83987
+    static constexpr int32_t MAG_BETA2 = 18368;   // 0.56055
     
-    struct Polar {
-        uint16_t angle;
-        int16_t magnitude;
-    };
+    // 1 / prod(sqrt(1 + 2^-2i)) over the CORDIC iterations, Q30
+    static constexpr int64_t CORDIC_GAIN_INV_Q30 = 652032874;
     
-    [[nodiscard]] static Polar to_polar(const Vec2& v) noexcept {
-        return {
-            TrigImpl::atan2(v.y, v.x),
-            static_cast<int16_t>(TrigImpl::magnitude(v.x, v.y))
-        };
+    // Table reads extended with the exact end point one past the last entry.
+    // Selected by mask, not a branch: near-diagonal atan2 inputs hit the end
+    // point at random. index <= TableSize, so the masked read stays in range.
+    static constexpr int32_t atan_entry(uint32_t index) noexcept {
+        int32_t in_table = -static_cast<int32_t>(index < TableSize);
+        return (atan_quarter_table[index & TABLE_MASK] & in_table) | (ATAN_END & ~in_table);
     }
     
-    [[nodiscard]] static Vec2 from_polar(const Polar& p) noexcept {
-        return {
-            static_cast<int16_t>((int32_t(p.magnitude) * TrigImpl::cos(p.angle)) >> 14),
-            static_cast<int16_t>((int32_t(p.magnitude) * TrigImpl::sin(p.angle)) >> 14)
-        };
+    static constexpr int32_t asin_entry(uint32_t index) noexcept {
+        int32_t in_table = -static_cast<int32_t>(index < TableSize);
+        return (asin_quarter_table[index & TABLE_MASK] & in_table) | (ASIN_END & ~in_table);
     }
     
-    [[nodiscard]] static Vec2 rotate(const Vec2& v, uint16_t angle) noexcept {
-        int16_t cos_a = TrigImpl::cos(angle);
-        int16_t sin_a = TrigImpl::sin(angle);
+    // Batch kernel shared by sin_batch and cos_batch
+    static void sin_batch_offset(std::span<const uint16_t> angles, std::span<int16_t> out,
+                                 uint16_t offset) noexcept {
+        const uint16_t* in = angles.data();
+        int16_t* dst = out.data();
+        std::size_t count = std::min(angles.size(), out.size());
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        i = count & ~std::size_t(7);
+        sin_batch_avx2(in, dst, i, offset);
+#elif defined(__SSE4_1__)
+        if constexpr (std::same_as<Interp, InterpolateLinear>) {
+            i = count & ~std::size_t(3);
+            sin_batch_sse41(in, dst, i, offset);
+        }
+#endif
+        for (; i < count; ++i) {
+            dst[i] = sin(in[i] + offset);
+        }
+    }
+    
+#if defined(__AVX2__)
+    // Quadrant decode for 8 angles: mirrored 16.16 table position and quadrant
+    static void decode_avx2(__m256i angle, __m256i& index_scaled, __m256i& quadrant) noexcept {
+        const __m256i one = _mm256_set1_epi32(1);
+        angle = _mm256_and_si256(angle, _mm256_set1_epi32(0x3FFF));
+        quadrant = _mm256_srli_epi32(angle, 12);
+        __m256i position = _mm256_and_si256(angle, _mm256_set1_epi32(0xFFF));
+        __m256i odd = _mm256_cmpeq_epi32(_mm256_and_si256(quadrant, one), one);
+        position = _mm256_blendv_epi8(position,
+            _mm256_sub_epi32(_mm256_set1_epi32(0x1000), position), odd);
+        index_scaled = _mm256_mullo_epi32(position, _mm256_set1_epi32(RECIPROCAL_QUADRANT));
+    }
+    
+    // Interpolated quarter-wave sine for 8 table positions; both end points
+    // come from one 32-bit gather of the adjacent int16 table entries
+    static __m256i quarter_lookup_avx2(__m256i index_scaled) noexcept {
+        if constexpr (std::same_as<Layout, LayoutInterleaved>) {
+            // One word per lane already holds the value and the delta
+            const int* pairs = reinterpret_cast<const int*>(sine_pair_table.data());
+            __m256i fraction = _mm256_and_si256(_mm256_srli_epi32(index_scaled, 8), _mm256_set1_epi32(0xFF));
+            __m256i entry = _mm256_i32gather_epi32(pairs, _mm256_srli_epi32(index_scaled, 16), 4);
+            __m256i y0 = _mm256_srai_epi32(_mm256_slli_epi32(entry, 16), 16);
+            __m256i delta = _mm256_srai_epi32(entry, 16);
+            return _mm256_add_epi32(y0, _mm256_srai_epi32(_mm256_mullo_epi32(delta, fraction), 8));
+        }
         
-        return {
-            static_cast<int16_t>((int32_t(v.x) * cos_a - int32_t(v.y) * sin_a) >> 14),
-            static_cast<int16_t>((int32_t(v.x) * sin_a + int32_t(v.y) * cos_a) >> 14)
-        };
+        const int* table = reinterpret_cast<const int*>(sine_quarter_table.data());
+        const __m256i last_pair = _mm256_set1_epi32(TableSize - 2);
+        
+        __m256i index = _mm256_srli_epi32(index_scaled, 16);
+        __m256i fraction = _mm256_and_si256(_mm256_srli_epi32(index_scaled, 8), _mm256_set1_epi32(0xFF));
+        
+        // index == TableSize - 1 only occurs with fraction 0; read the
+        // previous pair instead and take its upper entry in full
+        __m256i past = _mm256_cmpgt_epi32(index, last_pair);
+        index = _mm256_min_epi32(index, last_pair);
+        fraction = _mm256_blendv_epi8(fraction, _mm256_set1_epi32(0x100), past);
+        
+        __m256i pair = _mm256_i32gather_epi32(table, index, 2);
+        __m256i y0 = _mm256_srai_epi32(_mm256_slli_epi32(pair, 16), 16);
+        __m256i y1 = _mm256_srai_epi32(pair, 16);
+        return _mm256_add_epi32(y0,
+            _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(y1, y0), fraction), 8));
     }
-};
+    
+    static __m256i nearest_lookup_avx2(__m256i index_scaled) noexcept {
+        const int* table = reinterpret_cast<const int*>(sine_quarter_table.data());
+        const __m256i last_pair = _mm256_set1_epi32(TableSize - 2);
+        
+        // Rounded index can be TableSize - 1; read the pair below and take
+        // its upper entry so the gather stays inside the table
+        __m256i index = _mm256_srli_epi32(_mm256_add_epi32(index_scaled, _mm256_set1_epi32(0x8000)), 16);
+        __m256i past = _mm256_cmpgt_epi32(index, last_pair);
+        __m256i pair = _mm256_i32gather_epi32(table, _mm256_min_epi32(index, last_pair), 2);
+        return _mm256_blendv_epi8(_mm256_srai_epi32(_mm256_slli_epi32(pair, 16), 16),
+                                  _mm256_srai_epi32(pair, 16), past);
+    }
+    
+    // Same clamping as quarter_lookup_avx2, with t = 1.0 on the last entry;
+    // hermite() returns y1 exactly there, so results match the scalar path
+    static __m256i hermite_lookup_avx2(__m256i index_scaled) noexcept {
+        const int* table = reinterpret_cast<const int*>(sine_quarter_table.data());
+        const int* slopes = reinterpret_cast<const int*>(sine_slope_table.data());
+        const __m256i last_pair = _mm256_set1_epi32(TableSize - 2);
+        
+        __m256i index = _mm256_srli_epi32(index_scaled, 16);
+        __m256i t = _mm256_srli_epi32(_mm256_and_si256(index_scaled, _mm256_set1_epi32(0xFFFF)), 1);
+        
+        __m256i past = _mm256_cmpgt_epi32(index, last_pair);
+        index = _mm256_min_epi32(index, last_pair);
+        t = _mm256_blendv_epi8(t, _mm256_set1_epi32(1 << 15), past);
+        
+        __m256i pair = _mm256_i32gather_epi32(table, index, 2);
+        __m256i slope_pair = _mm256_i32gather_epi32(slopes, index, 2);
+        __m256i y0 = _mm256_srai_epi32(_mm256_slli_epi32(pair, 16), 16);
+        __m256i y1 = _mm256_srai_epi32(pair, 16);
+        __m256i m0 = _mm256_srai_epi32(_mm256_slli_epi32(slope_pair, 16), 16);
+        __m256i m1 = _mm256_srai_epi32(slope_pair, 16);
+        
+        __m256i dy = _mm256_sub_epi32(y1, y0);
+        __m256i dy2 = _mm256_add_epi32(dy, dy);
+        __m256i c2 = _mm256_sub_epi32(_mm256_add_epi32(dy2, dy), _mm256_add_epi32(_mm256_add_epi32(m0, m0), m1));
+        __m256i c3 = _mm256_sub_epi32(_mm256_add_epi32(m0, m1), dy2);
+        
+        const __m256i half = _mm256_set1_epi32(1 << 14);
+        __m256i acc = _mm256_add_epi32(c2,
+            _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(c3, t), half), 15));
+        acc = _mm256_add_epi32(m0, _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(acc, t), half), 15));
+        return _mm256_add_epi32(y0, _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(acc, t), half), 15));
+    }
+    
+    // Interpolated quarter-wave sine for 8 table positions, per policy
+    static __m256i sine_lookup_avx2(__m256i index_scaled) noexcept {
+        if constexpr (std::same_as<Interp, InterpolateNearest>) {
+            return nearest_lookup_avx2(index_scaled);
+        } else if constexpr (std::same_as<Interp, InterpolateHermite>) {
+            return hermite_lookup_avx2(index_scaled);
+        } else {
+            return quarter_lookup_avx2(index_scaled);
+        }
+    }
+    
+    // Conditional negate where sign is 0 or 1, then narrow to 8 x int16
+    static __m128i apply_sign_avx2(__m256i value, __m256i sign) noexcept {
+        __m256i mask = _mm256_sub_epi32(_mm256_setzero_si256(), sign);
+        value = _mm256_sub_epi32(_mm256_xor_si256(value, mask), mask);
+        return _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packs_epi32(value, value), 0x08));
+    }
+    
+    static __m256i load_angles_avx2(const uint16_t* angles) noexcept {
+        return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(angles)));
+    }
+    
+    // count must be a multiple of 8
+    static void sin_batch_avx2(const uint16_t* angles, int16_t* out,
+                               std::size_t count, uint16_t offset) noexcept {
+        const __m256i angle_offset = _mm256_set1_epi32(offset);
+        for (std::size_t i = 0; i < count; i += 8) {
+            __m256i index_scaled, quadrant;
+            decode_avx2(_mm256_add_epi32(load_angles_avx2(angles + i), angle_offset), index_scaled, quadrant);
+            __m256i value = sine_lookup_avx2(index_scaled);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                             apply_sign_avx2(value, _mm256_srli_epi32(quadrant, 1)));
+        }
+    }
+    
+    static void sincos_batch_avx2(const uint16_t* angles, int16_t* sin_out, int16_t* cos_out,
+                                  std::size_t count) noexcept {
+        const __m256i quarter_scaled = _mm256_set1_epi32(QUARTER_SCALED);
+        const __m256i one = _mm256_set1_epi32(1);
+        for (std::size_t i = 0; i < count; i += 8) {
+            __m256i sin_scaled, quadrant;
+            decode_avx2(load_angles_avx2(angles + i), sin_scaled, quadrant);
+            __m256i cos_scaled = _mm256_sub_epi32(quarter_scaled, sin_scaled);
+            
+            __m256i sin_sign = _mm256_srli_epi32(quadrant, 1);
+            __m256i cos_sign = _mm256_and_si256(_mm256_xor_si256(quadrant, sin_sign), one);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(sin_out + i),
+                             apply_sign_avx2(sine_lookup_avx2(sin_scaled), sin_sign));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(cos_out + i),
+                             apply_sign_avx2(sine_lookup_avx2(cos_scaled), cos_sign));
+        }
+    }
+    
+    // floor(v * c / 2^shift) for 0 <= v < 2^31, c < 2^shift and shift 15
+    // or 16; both partial products fit in 32-bit lanes
+    static __m256i mul_shift_avx2(__m256i v, __m256i c, int shift) noexcept {
+        __m256i low_mask = _mm256_set1_epi32((1 << shift) - 1);
+        __m256i high = _mm256_mullo_epi32(_mm256_srli_epi32(v, shift), c);
+        __m256i low = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_and_si256(v, low_mask), c), shift);
+        return _mm256_add_epi32(high, low);
+    }
+    
+    // count must be a multiple of 8; blocks with any |x| or |y| >= 2^29
+    // would overflow 32-bit lanes and go through the scalar path
+    template<MagnitudeMethod Method>
+    static void magnitude_batch_avx2(const int32_t* xs, const int32_t* ys, int32_t* out,
+                                     std::size_t count) noexcept {
+        const __m256i range_mask = _mm256_set1_epi32(~((1 << 29) - 1));
+        for (std::size_t i = 0; i < count; i += 8) {
+            __m256i x = _mm256_abs_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(xs + i)));
+            __m256i y = _mm256_abs_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ys + i)));
+            
+            if (!_mm256_testz_si256(_mm256_or_si256(x, y), range_mask)) {
+                for (std::size_t k = i; k < i + 8; ++k) {
+                    out[k] = magnitude<Method>(xs[k], ys[k]);
+                }
+                continue;
+            }
+            
+            __m256i result;
+            if constexpr (std::same_as<Method, MagnitudeAlphaBeta>) {
+                __m256i hi = _mm256_max_epi32(x, y);
+                __m256i lo = _mm256_min_epi32(x, y);
+                __m256i near_axis = _mm256_add_epi32(
+                    mul_shift_avx2(hi, _mm256_set1_epi32(MAG_ALPHA1), 15),
+                    mul_shift_avx2(lo, _mm256_set1_epi32(MAG_BETA1), 15));
+                __m256i near_diagonal = _mm256_add_epi32(
+                    mul_shift_avx2(hi, _mm256_set1_epi32(MAG_ALPHA2), 15),
+                    mul_shift_avx2(lo, _mm256_set1_epi32(MAG_BETA2), 15));
+                result = _mm256_max_epi32(near_axis, near_diagonal);
+            } else {
+                // shift = 28 - floor(log2(x | y)) from the float exponent.
+                // The conversion can round up to the next power of two,
+                // leaving the top bit at 27; one more step puts that right.
+                // Zero lanes get a shift past 31 and stay zero
+                __m256i larger = _mm256_or_si256(x, y);
+                __m256i exponent = _mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(larger)), 23);
+                __m256i shift = _mm256_sub_epi32(_mm256_set1_epi32(28 + 127), exponent);
+                shift = _mm256_sub_epi32(shift, _mm256_cmpgt_epi32(_mm256_set1_epi32(1 << 28),
+                                                                   _mm256_sllv_epi32(larger, shift)));
+                x = _mm256_sllv_epi32(x, shift);
+                y = _mm256_sllv_epi32(y, shift);
+                
+                for (int k = 0; k < 12; ++k) {
+                    __m256i d = _mm256_srai_epi32(y, 31);
+                    __m256i x_shift = _mm256_srai_epi32(x, k);
+                    __m256i y_shift = _mm256_srai_epi32(y, k);
+                    x = _mm256_add_epi32(x, _mm256_sub_epi32(_mm256_xor_si256(y_shift, d), d));
+                    y = _mm256_sub_epi32(y, _mm256_sub_epi32(_mm256_xor_si256(x_shift, d), d));
+                }
+                
+                // Lanes are below 2^29, so the shift is never negative
+                __m256i half = _mm256_srli_epi32(_mm256_sllv_epi32(_mm256_set1_epi32(1), shift), 1);
+                result = _mm256_srlv_epi32(_mm256_add_epi32(mul_shift_avx2(x, _mm256_set1_epi32(39797), 16), half),
+                                           shift);
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), result);
+        }
+    }
+    
+    // count must be a multiple of 8. int16 inputs always normalise with a
+    // left shift (13..28 bits), so every lane follows the same steps as
+    // to_polar(); the shift comes from the float exponent instead of clz.
+    static void to_polar_batch_avx2(const int16_t* xs, const int16_t* ys, uint16_t* angles,
+                                    int32_t* magnitudes, std::size_t count) noexcept {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i one64 = _mm256_set1_epi64x(1);
+        const __m256i low32 = _mm256_set1_epi64x(0xFFFFFFFF);
+        const __m256i gain = _mm256_set1_epi32(static_cast<int32_t>(CORDIC_GAIN_INV_Q30));
+        for (std::size_t i = 0; i < count; i += 8) {
+            __m256i x = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(xs + i)));
+            __m256i y = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ys + i)));
+            __m256i cx = _mm256_abs_epi32(x);
+            __m256i cy = _mm256_abs_epi32(y);
+            
+            // shift = clz(larger) - 3 = 28 - floor(log2(larger))
+            __m256i larger = _mm256_or_si256(cx, cy);
+            __m256i exponent = _mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(larger)), 23);
+            __m256i shift = _mm256_sub_epi32(_mm256_set1_epi32(28 + 127), exponent);
+            cx = _mm256_sllv_epi32(cx, shift);
+            cy = _mm256_sllv_epi32(cy, shift);
+            
+            __m256i angle = zero;
+            for (int k = 0; k < detail::CORDIC_ITERATIONS; ++k) {
+                __m256i d = _mm256_srai_epi32(cy, 31);
+                __m256i x_shift = _mm256_srai_epi32(cx, k);
+                __m256i y_shift = _mm256_srai_epi32(cy, k);
+                cx = _mm256_add_epi32(cx, _mm256_sub_epi32(_mm256_xor_si256(y_shift, d), d));
+                cy = _mm256_sub_epi32(cy, _mm256_sub_epi32(_mm256_xor_si256(x_shift, d), d));
+                __m256i step = _mm256_set1_epi32(detail::cordic_angle_table[k]);
+                angle = _mm256_add_epi32(angle, _mm256_sub_epi32(_mm256_xor_si256(step, d), d));
+            }
+            
+            // unfold_quadrant(): negate when one input is negative, + π when x is
+            __m256i sign_x = _mm256_srai_epi32(x, 31);
+            __m256i negate = _mm256_xor_si256(sign_x, _mm256_srai_epi32(y, 31));
+            angle = _mm256_srai_epi32(_mm256_add_epi32(angle, _mm256_set1_epi32(128)), 8);
+            angle = _mm256_sub_epi32(_mm256_xor_si256(angle, negate), negate);
+            angle = _mm256_add_epi32(angle, _mm256_and_si256(sign_x, _mm256_set1_epi32(8192)));
+            angle = _mm256_and_si256(angle, _mm256_set1_epi32(0x3FFF));
+            
+            // (cx · gain) >> 30, then the rounded shift back, in 64-bit lanes
+            __m256i shift_even = _mm256_and_si256(shift, low32);
+            __m256i shift_odd = _mm256_srli_epi64(shift, 32);
+            __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(cx, gain), 30);
+            __m256i odd = _mm256_srli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(cx, 32), gain), 30);
+            even = _mm256_srlv_epi64(_mm256_add_epi64(even, _mm256_sllv_epi64(one64, _mm256_sub_epi64(shift_even, one64))),
+                                     shift_even);
+            odd = _mm256_srlv_epi64(_mm256_add_epi64(odd, _mm256_sllv_epi64(one64, _mm256_sub_epi64(shift_odd, one64))),
+                                    shift_odd);
+            __m256i magnitude = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+            
+            // to_polar(0, 0) = {0, 0}
+            __m256i origin = _mm256_cmpeq_epi32(larger, zero);
+            angle = _mm256_andnot_si256(origin, angle);
+            magnitude = _mm256_andnot_si256(origin, magnitude);
+            
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(angles + i),
+                             _mm_packus_epi32(_mm256_castsi256_si128(angle), _mm256_extracti128_si256(angle, 1)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(magnitudes + i), magnitude);
+        }
+    }
+#elif defined(__SSE4_1__)
+    // Quadrant decode for 4 angles: mirrored 16.16 table position and quadrant
+    static void decode_sse41(__m128i angle, __m128i& index_scaled, __m128i& quadrant) noexcept {
+        const __m128i one = _mm_set1_epi32(1);
+        angle = _mm_and_si128(angle, _mm_set1_epi32(0x3FFF));
+        quadrant = _mm_srli_epi32(angle, 12);
+        __m128i position = _mm_and_si128(angle, _mm_set1_epi32(0xFFF));
+        __m128i odd = _mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one);
+        position = _mm_blendv_epi8(position, _mm_sub_epi32(_mm_set1_epi32(0x1000), position), odd);
+        index_scaled = _mm_mullo_epi32(position, _mm_set1_epi32(RECIPROCAL_QUADRANT));
+    }
+    
+    // Interpolated quarter-wave sine for 4 table positions; the table pairs
+    // are loaded per lane and shuffled into place
+    static __m128i quarter_lookup_sse41(__m128i index_scaled) noexcept {
+        if constexpr (std::same_as<Layout, LayoutInterleaved>) {
+            int32_t lanes[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), _mm_srli_epi32(index_scaled, 16));
+            __m128i entry = _mm_setr_epi32(int32_t(sine_pair_table[lanes[0]]), int32_t(sine_pair_table[lanes[1]]),
+                                           int32_t(sine_pair_table[lanes[2]]), int32_t(sine_pair_table[lanes[3]]));
+            __m128i fraction = _mm_and_si128(_mm_srli_epi32(index_scaled, 8), _mm_set1_epi32(0xFF));
+            __m128i y0 = _mm_srai_epi32(_mm_slli_epi32(entry, 16), 16);
+            __m128i delta = _mm_srai_epi32(entry, 16);
+            return _mm_add_epi32(y0, _mm_srai_epi32(_mm_mullo_epi32(delta, fraction), 8));
+        }
+        
+        const int16_t* table = sine_quarter_table.data();
+        const __m128i last_pair = _mm_set1_epi32(TableSize - 2);
+        
+        __m128i index = _mm_srli_epi32(index_scaled, 16);
+        __m128i fraction = _mm_and_si128(_mm_srli_epi32(index_scaled, 8), _mm_set1_epi32(0xFF));
+        
+        __m128i past = _mm_cmpgt_epi32(index, last_pair);
+        index = _mm_min_epi32(index, last_pair);
+        fraction = _mm_blendv_epi8(fraction, _mm_set1_epi32(0x100), past);
+        
+        int32_t lanes[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), index);
+        int32_t pairs[4];
+        for (int lane = 0; lane < 4; ++lane) {
+            std::memcpy(&pairs[lane], table + lanes[lane], sizeof(int32_t));
+        }
+        __m128i pair = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pairs));
+        __m128i y0 = _mm_srai_epi32(_mm_slli_epi32(pair, 16), 16);
+        __m128i y1 = _mm_srai_epi32(pair, 16);
+        return _mm_add_epi32(y0, _mm_srai_epi32(_mm_mullo_epi32(_mm_sub_epi32(y1, y0), fraction), 8));
+    }
+    
+    // Conditional negate where sign is 0 or 1, then narrow to 4 x int16
+    static __m128i apply_sign_sse41(__m128i value, __m128i sign) noexcept {
+        __m128i mask = _mm_sub_epi32(_mm_setzero_si128(), sign);
+        value = _mm_sub_epi32(_mm_xor_si128(value, mask), mask);
+        return _mm_packs_epi32(value, value);
+    }
+    
+    static __m128i load_angles_sse41(const uint16_t* angles) noexcept {
+        return _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(angles)));
+    }
+    
+    // count must be a multiple of 4
+    static void sin_batch_sse41(const uint16_t* angles, int16_t* out,
+                                std::size_t count, uint16_t offset) noexcept {
+        const __m128i angle_offset = _mm_set1_epi32(offset);
+        for (std::size_t i = 0; i < count; i += 4) {
+            __m128i index_scaled, quadrant;
+            decode_sse41(_mm_add_epi32(load_angles_sse41(angles + i), angle_offset), index_scaled, quadrant);
+            __m128i value = quarter_lookup_sse41(index_scaled);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i),
+                             apply_sign_sse41(value, _mm_srli_epi32(quadrant, 1)));
+        }
+    }
+    
+    static void sincos_batch_sse41(const uint16_t* angles, int16_t* sin_out, int16_t* cos_out,
+                                   std::size_t count) noexcept {
+        const __m128i quarter_scaled = _mm_set1_epi32(QUARTER_SCALED);
+        const __m128i one = _mm_set1_epi32(1);
+        for (std::size_t i = 0; i < count; i += 4) {
+            __m128i sin_scaled, quadrant;
+            decode_sse41(load_angles_sse41(angles + i), sin_scaled, quadrant);
+            __m128i cos_scaled = _mm_sub_epi32(quarter_scaled, sin_scaled);
+            
+            __m128i sin_sign = _mm_srli_epi32(quadrant, 1);
+            __m128i cos_sign = _mm_and_si128(_mm_xor_si128(quadrant, sin_sign), one);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(sin_out + i),
+                             apply_sign_sse41(quarter_lookup_sse41(sin_scaled), sin_sign));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(cos_out + i),
+                             apply_sign_sse41(quarter_lookup_sse41(cos_scaled), cos_sign));
+        }
+    }
+#endif
+    
+    // Table generation for sine (quarter wave, end points inclusive)
+    static constexpr std::array<int16_t, TableSize> generate_sine_quarter_table() {
+        std::array<int16_t, TableSize> table{};
+        for (std::size_t i = 0; i < TableSize; ++i) {
+            int64_t angle_q8 = (int64_t(i) * (4096 << 8) + (TableSize - 1) / 2) / (TableSize - 1);
+            int64_t value = (detail::sin_q30(angle_q8) + (1 << 15)) >> 16;
+            table[i] = static_cast<int16_t>(value > 16384 ? 16384 : value);
+        }
+        return table;
+    }
+    
+    // Slope of each sine table entry per table interval, in output units:
+    // cos(θi) · (π/2) / (TableSize - 1) · 16384
+    static constexpr std::array<int16_t, TableSize> generate_sine_slope_table() {
+        std::array<int16_t, TableSize> table{};
+        constexpr int64_t step_q30 = (detail::PI_Q30 / 2 + (TableSize - 1) / 2) / (TableSize - 1);
+        for (std::size_t i = 0; i < TableSize; ++i) {
+            int64_t angle_q8 = (int64_t(TableSize - 1 - i) * (4096 << 8) + (TableSize - 1) / 2) / (TableSize - 1);
+            int64_t cos_q30 = detail::sin_q30(angle_q8);
+            table[i] = static_cast<int16_t>((cos_q30 * step_q30 + (int64_t(1) << 45)) >> 46);
+        }
+        return table;
+    }
+    
+    // Interleaved layout: low half the sine entry, high half the difference
+    // to the next entry (0 for the last, which is only read with fraction 0)
+    static constexpr std::array<uint32_t, TableSize> generate_sine_pair_table() {
+        std::array<uint32_t, TableSize> table{};
+        for (std::size_t i = 0; i < TableSize; ++i) {
+            int32_t value = sine_quarter_table[i];
+            int32_t delta = (i + 1 < TableSize) ? sine_quarter_table[i + 1] - value : 0;
+            table[i] = uint32_t(uint16_t(value)) | (uint32_t(uint16_t(delta)) << 16);
+        }
+        return table;
+    }
+    
+    // Table generation for atan (quarter range): atan(i / TableSize)
+    static constexpr std::array<uint16_t, TableSize> generate_atan_quarter_table() {
+        std::array<uint16_t, TableSize> table{};
+        for (std::size_t i = 0; i < TableSize; ++i) {
+            int64_t angle_q8 = detail::atan_q8(i, TableSize);
+            table[i] = static_cast<uint16_t>((angle_q8 + 128) >> 8);
+        }
+        return table;
+    }
+    
+    // Table generation for asin (quarter range): asin(i / TableSize)
+    static constexpr std::array<uint16_t, TableSize> generate_asin_quarter_table() {
+        std::array<uint16_t, TableSize> table{};
+        for (std::size_t i = 0; i < TableSize; ++i) {
+            int64_t target = (int64_t(i) << 30) / TableSize;
+            uint32_t low = 0;
+            uint32_t high = 4096 << 4;
+            
+            while (high - low > 1) {
+                uint32_t mid = (low + high) / 2;
+                int64_t sin_mid = detail::sin_q30(int64_t(mid) << 4);
+                
+                if (sin_mid < target) {
+                    low = mid;
+                } else {
+                    high = mid;
+                }
+            }
+            
+            table[i] = static_cast<uint16_t>((high + 8) >> 4);
+        }
+        return table;
+    }
+    
+    // Lookup tables (using quarter-wave/range symmetry)
+    alignas(64) static constexpr auto sine_quarter_table = generate_sine_quarter_table();
+    alignas(64) static constexpr auto atan_quarter_table = generate_atan_quarter_table();
+    alignas(64) static constexpr auto asin_quarter_table = generate_asin_quarter_table();
+    alignas(64) static constexpr auto sine_slope_table = generate_sine_slope_table();
+    alignas(64) static constexpr auto sine_pair_table = generate_sine_pair_table();
+};
+
+// Convenient type aliases for common configurations
+using Trig32 = IntegerTrig<32>;    // 96 bytes - Ultra compact
+using Trig64 = IntegerTrig<64>;    // 192 bytes - Compact
+using Trig128 = IntegerTrig<128>;  // 384 bytes - Balanced (recommended)
+using Trig256 = IntegerTrig<256>;  // 768 bytes - High precision
+using Trig512 = IntegerTrig<512>;  // 1536 bytes - Very high precision
+
+// Default configuration
+using Trig = Trig128;
+
+// Sine table only; asin/acos/atan derived from it (one third of the memory)
+template<std::size_t TableSize = 128>
+using TrigMinimal = IntegerTrig<TableSize, AtanDivide, InterpolateLinear, LayoutSplit, MemoryMinimal>;
+
+// ============================================================
+// High-precision variant: 32-bit angles, Q31 outputs
+// ============================================================
+
+// Angles: 2^32 per turn (uint32_t wraps exactly once per turn, so a 32-bit
+// phase accumulator is an angle). Outputs: Q31, +1.0 saturates to INT32_MAX.
+// The quarter-wave table has TableSize intervals and TableSize + 1 entries,
+// so the table position is a shift, not a multiply. Interpolation is done
+// in 64-bit arithmetic.
+template<std::size_t TableSize = 1024, Interpolation Interp = InterpolateLinear>
+requires (TableSize >= 8 && TableSize <= 16384 && (TableSize & (TableSize - 1)) == 0)
+class IntegerTrig32 {
+public:
+    static constexpr uint32_t QUARTER_TURN = 1u << 30;   // π/2 in angle units
+    static constexpr uint32_t HALF_TURN = 1u << 31;      // π in angle units
+    
+    // Sine, Q31
+    [[nodiscard]] 
+    static constexpr int32_t sin(uint32_t angle) noexcept {
+        uint32_t quadrant = angle >> 30;
+        uint32_t position = angle & (QUARTER_TURN - 1);
+        
+        if (quadrant & 1) {
+            position = QUARTER_TURN - position;
+        }
+        
+        int32_t value = quarter_lookup(position);
+        int32_t sign_mask = -static_cast<int32_t>(quadrant >> 1);
+        return (value ^ sign_mask) - sign_mask;
+    }
+    
+    [[nodiscard]] 
+    static constexpr int32_t cos(uint32_t angle) noexcept {
+        return sin(angle + QUARTER_TURN);
+    }
+    
+    // One quadrant decode for both outputs; bit-exact with sin() and cos()
+    static constexpr void sincos(uint32_t angle, int32_t& sin_out, int32_t& cos_out) noexcept {
+        uint32_t quadrant = angle >> 30;
+        uint32_t position = angle & (QUARTER_TURN - 1);
+        
+        if (quadrant & 1) {
+            position = QUARTER_TURN - position;
+        }
+        
+        int32_t sin_value = quarter_lookup(position);
+        int32_t cos_value = quarter_lookup(QUARTER_TURN - position);
+        
+        int32_t sin_mask = -static_cast<int32_t>(quadrant >> 1);
+        int32_t cos_mask = -static_cast<int32_t>((quadrant ^ (quadrant >> 1)) & 1);
+        sin_out = (sin_value ^ sin_mask) - sin_mask;
+        cos_out = (cos_value ^ cos_mask) - cos_mask;
+    }
+    
+    // sin/cos as Q0.31 fixed point; the same bits as the int32_t versions
+    [[nodiscard]] 
+    static constexpr Q31 sin_fixed(uint32_t angle) noexcept {
+        return Q31::from_raw(sin(angle));
+    }
+    
+    [[nodiscard]] 
+    static constexpr Q31 cos_fixed(uint32_t angle) noexcept {
+        return Q31::from_raw(cos(angle));
+    }
+    
+    static constexpr void sincos(uint32_t angle, Q31& sin_out, Q31& cos_out) noexcept {
+        int32_t sin_value, cos_value;
+        sincos(angle, sin_value, cos_value);
+        sin_out = Q31::from_raw(sin_value);
+        cos_out = Q31::from_raw(cos_value);
+    }
+
+    // Typed angles; every binary angle, Degrees and Milliradians convert to
+    // Angle32 implicitly
+    [[nodiscard]] 
+    static constexpr int32_t sin(Angle32 angle) noexcept { return sin(angle.raw()); }
+    
+    [[nodiscard]] 
+    static constexpr int32_t cos(Angle32 angle) noexcept { return cos(angle.raw()); }
+    
+    static constexpr void sincos(Angle32 angle, Q31& sin_out, Q31& cos_out) noexcept {
+        sincos(angle.raw(), sin_out, cos_out);
+    }
+    
+    // atan2 as a typed angle of any width, e.g. atan2<16>(y, x)
+    template<int TurnBits>
+    [[nodiscard]] 
+    static Angle<TurnBits> atan2(int32_t y, int32_t x) noexcept {
+        return angle_cast<Angle<TurnBits>, RoundNearest>(Angle32::from_raw(atan2(y, x)));
+    }
+    
+    // Angle of (x, y) by vectoring CORDIC in 64-bit; error below 2 angle units
+    // (about 3e-9 rad) for any int32 input
+    [[nodiscard]] 
+    static uint32_t atan2(int32_t y, int32_t x) noexcept {
+        if ((x | y) == 0) return 0;
+        
+        uint32_t abs_x = (x < 0) ? 0u - uint32_t(x) : uint32_t(x);
+        uint32_t abs_y = (y < 0) ? 0u - uint32_t(y) : uint32_t(y);
+        
+        // Larger input to bit 60; CORDIC gain times √2 stays below 2^62
+        int shift = __builtin_clz(abs_x | abs_y) + 29;
+        int64_t cx = int64_t(abs_x) << shift;
+        int64_t cy = int64_t(abs_y) << shift;
+        
+        int64_t angle = 0;
+        for (int i = 0; i < CORDIC_ITERATIONS; ++i) {
+            int64_t d = cy >> 63;
+            int64_t x_shift = cx >> i;
+            int64_t y_shift = cy >> i;
+            
+            cx += (y_shift ^ d) - d;
+            cy -= (x_shift ^ d) - d;
+            angle += (cordic_angle_table[i] ^ d) - d;
+        }
+        
+        // First-quadrant angle back to the quadrant of (x, y)
+        uint32_t first = static_cast<uint32_t>((angle + 128) >> 8);
+        if (x < 0) first = HALF_TURN - first;
+        return (y < 0) ? 0u - first : first;
+    }
+    
+    // ============================================================
+    // Batch functions
+    // ============================================================
+    
+    // Plain loops over sin()/sincos(); the compiler unrolls and schedules
+    // them, and results are bit-exact with the scalar calls
+    // Process min(input size, output size(s)) elements
+    static void sin_batch(std::span<const uint32_t> angles, std::span<int32_t> out) noexcept {
+        std::size_t count = std::min(angles.size(), out.size());
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = sin(angles[i]);
+        }
+    }
+    
+    static void cos_batch(std::span<const uint32_t> angles, std::span<int32_t> out) noexcept {
+        std::size_t count = std::min(angles.size(), out.size());
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = cos(angles[i]);
+        }
+    }
+    
+    static void sincos_batch(std::span<const uint32_t> angles,
+                             std::span<int32_t> sin_out, std::span<int32_t> cos_out) noexcept {
+        std::size_t count = std::min({angles.size(), sin_out.size(), cos_out.size()});
+        for (std::size_t i = 0; i < count; ++i) {
+            sincos(angles[i], sin_out[i], cos_out[i]);
+        }
+    }
+    
+    // 14-bit IntegerTrig angle to a 32-bit angle
+    [[nodiscard]] static constexpr uint32_t from_angle14(uint16_t angle) noexcept {
+        return uint32_t(angle & 0x3FFF) << 18;
+    }
+    
+    static constexpr std::size_t table_memory() {
+        std::size_t slopes = std::same_as<Interp, InterpolateHermite> ? sizeof(slope_table) : 0;
+        return sizeof(sine_table) + slopes;
+    }
+    
+    static constexpr std::size_t table_size() { return TableSize; }
+
+private:
+    static constexpr int TABLE_BITS = __builtin_ctz(TableSize);
+    static constexpr int FRACTION_BITS = 30 - TABLE_BITS;
+    static constexpr uint32_t FRACTION_MASK = (1u << FRACTION_BITS) - 1;
+    static constexpr int CORDIC_ITERATIONS = 32;
+    
+    // Interpolated quarter-wave sine at position 0 .. 2^30
+    static constexpr int32_t quarter_lookup(uint32_t position) noexcept {
+        uint32_t index = position >> FRACTION_BITS;
+        
+        if constexpr (std::same_as<Interp, InterpolateNearest>) {
+            return sine_table[(position + (FRACTION_MASK >> 1) + 1) >> FRACTION_BITS];
+        } else {
+            // position 2^30 gives index TableSize with a zero fraction
+            uint32_t next = (index < TableSize) ? index + 1 : index;
+            int64_t y0 = sine_table[index];
+            int64_t y1 = sine_table[next];
+            int64_t fraction = position & FRACTION_MASK;
+            
+            if constexpr (std::same_as<Interp, InterpolateHermite>) {
+                // Same Horner form as IntegerTrig::hermite, t in Q30
+                int64_t t = fraction << (30 - FRACTION_BITS);
+                int64_t m0 = slope_table[index];
+                int64_t m1 = slope_table[next];
+                int64_t c2 = 3 * (y1 - y0) - 2 * m0 - m1;
+                int64_t c3 = 2 * (y0 - y1) + m0 + m1;
+                int64_t acc = c2 + ((c3 * t + (1 << 29)) >> 30);
+                acc = m0 + ((acc * t + (1 << 29)) >> 30);
+                // The cubic can overshoot the saturated +1.0 entry slightly
+                int64_t value = y0 + ((acc * t + (1 << 29)) >> 30);
+                return static_cast<int32_t>(value < INT32_MAX ? value : INT32_MAX);
+            } else {
+                return static_cast<int32_t>(y0 + (((y1 - y0) * fraction) >> FRACTION_BITS));
+            }
+        }
+    }
+    
+    static constexpr int32_t to_q31(double value) {
+        double scaled = value * 2147483648.0 + 0.5;
+        return (scaled >= 2147483647.0) ? INT32_MAX : static_cast<int32_t>(static_cast<int64_t>(scaled));
+    }
+    
+    // sin(i · (π/2) / TableSize), i = 0 .. TableSize
+    static constexpr std::array<int32_t, TableSize + 1> generate_sine_table() {
+        std::array<int32_t, TableSize + 1> table{};
+        for (std::size_t i = 0; i <= TableSize; ++i) {
+            table[i] = to_q31(detail::sin_series(detail::PI_DOUBLE / 2 * double(i) / TableSize));
+        }
+        return table;
+    }
+    
+    // Slope per table interval: cos(θi) · (π/2) / TableSize, Q31
+    static constexpr std::array<int32_t, TableSize + 1> generate_slope_table() {
+        std::array<int32_t, TableSize + 1> table{};
+        constexpr double step = detail::PI_DOUBLE / 2 / TableSize;
+        for (std::size_t i = 0; i <= TableSize; ++i) {
+            table[i] = to_q31(detail::sin_series(step * double(TableSize - i)) * step);
+        }
+        return table;
+    }
+    
+    // atan(2^-i) in 1/256 angle units (2^40 per turn)
+    static constexpr std::array<int64_t, CORDIC_ITERATIONS> generate_cordic_angle_table() {
+        std::array<int64_t, CORDIC_ITERATIONS> table{};
+        double x = 1.0;
+        for (int i = 0; i < CORDIC_ITERATIONS; ++i) {
+            double turns = detail::atan_series(x) / (2 * detail::PI_DOUBLE);
+            table[i] = static_cast<int64_t>(turns * 1099511627776.0 + 0.5);
+            x /= 2;
+        }
+        return table;
+    }
+    
+    alignas(64) static constexpr auto sine_table = generate_sine_table();
+    alignas(64) static constexpr auto slope_table = generate_slope_table();
+    static constexpr auto cordic_angle_table = generate_cordic_angle_table();
+};
+
+using TrigQ31 = IntegerTrig32<1024>;                          // 4 KB, ~3e-7 max error
+using TrigQ31Hermite = IntegerTrig32<256, InterpolateHermite>; // 2 KB, ~1e-9 max error
+
+// ============================================================
+// Table-free backend: minimax polynomials
+// ============================================================
+
+// Same static API and scaling as IntegerTrig, with no lookup tables: sin/cos
+// evaluate an odd minimax polynomial of the given Degree on the quarter
+// wave, atan one of Degree + 2 on [0, 1]. Everything is 32-bit integer
+// arithmetic with Q15 coefficients; atan2 needs one division.
+//
+// Measured max error (sin/cos in LSB of 16384, atan2/asin in angle units):
+//   PolyTrig<3>: sin 133, atan2 3.4
+//   PolyTrig<5>: sin 3.0, atan2 1.2
+//   PolyTrig<7>: sin 1.1, atan2 0.7
+template<int Degree = 5>
+requires (Degree == 3 || Degree == 5 || Degree == 7)
+class PolyTrig {
+public:
+    static constexpr uint16_t ANGLE_MAX = 8192;      // π in angle units
+    static constexpr int16_t OUTPUT_SCALE = 8192;    // tan() scale; sin/cos use ±16384 for ±1.0
+    
+    [[nodiscard]] 
+    static constexpr int16_t sin(uint16_t angle) noexcept {
+        angle &= 0x3FFF;
+        
+        uint8_t quadrant = angle >> 12;
+        uint16_t position = angle & 0xFFF;
+        
+        if (quadrant & 1) {
+            position = 0x1000 - position;
+        }
+        
+        int16_t value = quarter_sine(position);
+        int16_t sign_mask = -(quadrant >> 1);
+        return (value ^ sign_mask) - sign_mask;
+    }
+    
+    [[nodiscard]] 
+    static constexpr int16_t cos(uint16_t angle) noexcept {
+        return sin(angle + (ANGLE_MAX >> 1));
+    }
+    
+    [[nodiscard]] 
+    static int16_t tan(uint16_t angle) noexcept {
+        int16_t sin_val, cos_val;
+        sincos(angle, sin_val, cos_val);
+        
+        if (cos_val > -100 && cos_val < 100) {
+            return (sin_val >= 0) ? 32767 : -32767;
+        }
+        
+        int32_t result = (int32_t(sin_val) * OUTPUT_SCALE) / cos_val;
+        
+        if (result > 32767) return 32767;
+        if (result < -32767) return -32767;
+        
+        return static_cast<int16_t>(result);
+    }
+    
+    // Bit-exact with sin() and cos()
+    static constexpr void sincos(uint16_t angle, int16_t& sin_out, int16_t& cos_out) noexcept {
+        angle &= 0x3FFF;
+        
+        uint8_t quadrant = angle >> 12;
+        uint16_t position = angle & 0xFFF;
+        
+        if (quadrant & 1) {
+            position = 0x1000 - position;
+        }
+        
+        int16_t sin_value = quarter_sine(position);
+        int16_t cos_value = quarter_sine(0x1000 - position);
+        
+        int16_t sin_mask = -(quadrant >> 1);
+        int16_t cos_mask = -((quadrant ^ (quadrant >> 1)) & 1);
+        sin_out = (sin_value ^ sin_mask) - sin_mask;
+        cos_out = (cos_value ^ cos_mask) - cos_mask;
+    }
+    
+    // sin/cos as Q1.14 fixed point; the same bits as the int16_t versions
+    [[nodiscard]] 
+    static constexpr Q14 sin_fixed(uint16_t angle) noexcept {
+        return Q14::from_raw(sin(angle));
+    }
+    
+    [[nodiscard]] 
+    static constexpr Q14 cos_fixed(uint16_t angle) noexcept {
+        return Q14::from_raw(cos(angle));
+    }
+    
+    static constexpr void sincos(uint16_t angle, Q14& sin_out, Q14& cos_out) noexcept {
+        int16_t sin_value, cos_value;
+        sincos(angle, sin_value, cos_value);
+        sin_out = Q14::from_raw(sin_value);
+        cos_out = Q14::from_raw(cos_value);
+    }
+
+    // Typed angles. Degrees, Milliradians and coarser binary angles convert
+    // to Angle14 implicitly; finer ones (Angle16, Angle32) need angle_cast.
+    [[nodiscard]] 
+    static constexpr int16_t sin(Angle14 angle) noexcept { return sin(angle.raw()); }
+    
+    [[nodiscard]] 
+    static constexpr int16_t cos(Angle14 angle) noexcept { return cos(angle.raw()); }
+    
+    static constexpr void sincos(Angle14 angle, Q14& sin_out, Q14& cos_out) noexcept {
+        sincos(angle.raw(), sin_out, cos_out);
+    }
+    
+    // atan2 as a typed angle of any width, e.g. atan2<16>(y, x)
+    template<int TurnBits>
+    [[nodiscard]] 
+    static Angle<TurnBits> atan2(int16_t y, int16_t x) noexcept {
+        return angle_cast<Angle<TurnBits>, RoundNearest>(Angle14::from_raw(atan2(y, x)));
+    }
+    
+    [[nodiscard]] 
+    static uint16_t atan2(int16_t y, int16_t x) noexcept {
+        uint32_t abs_x = (x < 0) ? -int32_t(x) : x;
+        uint32_t abs_y = (y < 0) ? -int32_t(y) : y;
+        uint8_t quadrant_adjust = ((x < 0) << 1) | (y < 0);
+        
+        return detail::unfold_quadrant(first_quadrant(abs_x, abs_y), quadrant_adjust);
+    }
+    
+    [[nodiscard]] 
+    static uint16_t atan(int16_t value) noexcept {
+        return atan2(value, OUTPUT_SCALE * 2);
+    }
+    
+    // asin(v) = atan2(v, sqrt(1 - v²)); input ±16384 for ±1.0
+    [[nodiscard]] 
+    static uint16_t asin(int16_t value) noexcept {
+        uint32_t abs_val = (value < 0) ? -int32_t(value) : value;
+        abs_val = (abs_val > OUTPUT_SCALE * 2) ? OUTPUT_SCALE * 2 : abs_val;
+        
+        uint32_t adjacent = detail::isqrt32((uint32_t(1) << 28) - abs_val * abs_val);
+        uint16_t angle = first_quadrant(adjacent, abs_val);
+        
+        return (value < 0) ? (2 * ANGLE_MAX - angle) : angle;
+    }
+    
+    [[nodiscard]] 
+    static uint16_t acos(int16_t value) noexcept {
+        uint16_t asin_result = asin(value);
+        return ((ANGLE_MAX >> 1) - asin_result) & 0x3FFF;
+    }
+    
+    // Magnitude methods are table-free already; shared with IntegerTrig
+    template<MagnitudeMethod Method = MagnitudeCordic>
+    [[nodiscard]] 
+    static int32_t magnitude(int32_t x, int32_t y) noexcept {
+        return IntegerTrig<>::template magnitude<Method>(x, y);
+    }
+    
+    struct Polar {
+        uint16_t angle;     // 0-16384 (0-2π)
+        int32_t magnitude;  // sqrt(x² + y²)
+    };
+    
+    // Polynomial angle plus CORDIC magnitude; any int32 input range
+    [[nodiscard]] 
+    static Polar to_polar(int32_t x, int32_t y) noexcept {
+        uint32_t abs_x = (x < 0) ? 0u - uint32_t(x) : uint32_t(x);
+        uint32_t abs_y = (y < 0) ? 0u - uint32_t(y) : uint32_t(y);
+        uint8_t quadrant_adjust = ((x < 0) << 1) | (y < 0);
+        
+        // The ratio only needs 16 significant bits
+        uint32_t larger = abs_x | abs_y;
+        int shift = (larger >> 16) ? 16 - __builtin_clz(larger) : 0;
+        uint16_t angle = first_quadrant(abs_x >> shift, abs_y >> shift);
+        
+        return {detail::unfold_quadrant(angle, quadrant_adjust), magnitude(x, y)};
+    }
+    
+    // ============================================================
+    // Batch functions
+    // ============================================================
+    
+    // Straight-line loops with no table reads; they autovectorise when the
+    // target has 32-bit multiplies in SIMD (e.g. -mavx2, -mfpu=neon)
+    static void sin_batch(std::span<const uint16_t> angles, std::span<int16_t> out) noexcept {
+        std::size_t count = std::min(angles.size(), out.size());
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = sin(angles[i]);
+        }
+    }
+    
+    static void cos_batch(std::span<const uint16_t> angles, std::span<int16_t> out) noexcept {
+        std::size_t count = std::min(angles.size(), out.size());
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = cos(angles[i]);
+        }
+    }
+    
+    static void sincos_batch(std::span<const uint16_t> angles,
+                             std::span<int16_t> sin_out, std::span<int16_t> cos_out) noexcept {
+        std::size_t count = std::min({angles.size(), sin_out.size(), cos_out.size()});
+        for (std::size_t i = 0; i < count; ++i) {
+            sincos(angles[i], sin_out[i], cos_out[i]);
+        }
+    }
+    
+    template<MagnitudeMethod Method = MagnitudeCordic>
+    static void magnitude_batch(std::span<const int32_t> xs, std::span<const int32_t> ys,
+                                std::span<int32_t> out) noexcept {
+        IntegerTrig<>::template magnitude_batch<Method>(xs, ys, out);
+    }
+    
+    static void to_polar_batch(std::span<const int16_t> xs, std::span<const int16_t> ys,
+                               std::span<uint16_t> angles, std::span<int32_t> magnitudes) noexcept {
+        std::size_t count = std::min({xs.size(), ys.size(), angles.size(), magnitudes.size()});
+        for (std::size_t i = 0; i < count; ++i) {
+            Polar polar = to_polar(xs[i], ys[i]);
+            angles[i] = polar.angle;
+            magnitudes[i] = polar.magnitude;
+        }
+    }
+    
+    static constexpr std::size_t table_memory() { return 0; }
+    static constexpr std::size_t table_size() { return 0; }
+    static constexpr int degree() { return Degree; }
+
+private:
+    // Odd minimax polynomials (Remez, absolute error), Q15 coefficients,
+    // lowest power first
+    // sin(π/2 · u), u in [0, 1]
+    static constexpr auto SIN_COEFFS = [] {
+        if constexpr (Degree == 3) {
+            return std::array<int32_t, 2>{50865, -18097};
+        } else if constexpr (Degree == 5) {
+            return std::array<int32_t, 3>{51467, -21071, 2372};
+        } else {
+            return std::array<int32_t, 4>{51472, -21166, 2605, -143};
+        }
+    }();
+    
+    // atan(t) / (π/4), t in [0, 1]
+    static constexpr auto ATAN_COEFFS = [] {
+        if constexpr (Degree == 3) {
+            return std::array<int32_t, 3>{41641, -12339, 3466};
+        } else if constexpr (Degree == 5) {
+            return std::array<int32_t, 4>{41716, -13626, 6511, -1834};
+        } else {
+            return detail::atan_minimax_q15;
+        }
+    }();
+    
+    // Quarter-wave sine at position 0 .. 4096, output 0 .. 16384
+    static constexpr int16_t quarter_sine(uint16_t position) noexcept {
+        int32_t value = (detail::odd_polynomial(SIN_COEFFS, int32_t(position) << 3) + (1 << 15)) >> 16;
+        return static_cast<int16_t>(value < 16384 ? value : 16384);
+    }
+    
+    // First-quadrant angle of (abs_x, abs_y), both <= 2^16, 0 .. 4096
+    static constexpr uint16_t first_quadrant(uint32_t abs_x, uint32_t abs_y) noexcept {
+        if (abs_x == abs_y) {
+            return abs_x ? (ANGLE_MAX >> 2) : 0;
+        }
+        bool steep = abs_y > abs_x;
+        uint32_t num = steep ? abs_x : abs_y;
+        uint32_t den = steep ? abs_y : abs_x;
+        
+        int32_t t = static_cast<int32_t>((num << 15) / den);
+        int32_t angle = (detail::odd_polynomial(ATAN_COEFFS, t) + (1 << 18)) >> 19;
+        return static_cast<uint16_t>(steep ? (ANGLE_MAX >> 1) - angle : angle);
+    }
+};
+
+// ============================================================
+// Direct-lookup atan2 for low-resolution inputs
+// ============================================================
+
+namespace detail {
+
+// atan(minor / major) in angle units (0 .. 2048) for every integer pair
+// with major in [2^(Bits-1), 2^Bits] and 0 <= minor <= major. Row `major`
+// holds major + 1 entries.
+template<int Bits>
+inline constexpr auto atan2_octant_table = [] {
+    constexpr uint32_t half = 1u << (Bits - 1);
+    std::array<uint16_t, ((2 * half + 1) * (2 * half + 2) - half * (half + 1)) / 2> table{};
+    std::size_t i = 0;
+    for (uint32_t major = half; major <= 2 * half; ++major) {
+        for (uint32_t minor = 0; minor <= major; ++minor) {
+            table[i++] = static_cast<uint16_t>((atan_q8(minor, major) + 128) >> 8);
+        }
+    }
+    return table;
+}();
+
+} // namespace detail
+
+// atan2 by a single read from a 2-D table; no division, no loop.
+// |x| and |y| are folded into the first octant and scaled by a common
+// power of two so that the larger one lands in [2^(Bits-1), 2^Bits]: exact
+// left shifts for small inputs, rounded right shifts for larger ones.
+// Same angle convention as IntegerTrig::atan2.
+//
+// Error bound (angle units, 16384 per turn):
+//   max(|x|, |y|) < 2^Bits:  0.51 (table rounding only)
+//   otherwise:               0.51 + 1574 / 2^(Bits-1)
+// e.g. Bits = 6 is exact for 6-bit inputs and within 50 units (1.1°) for
+// any int16, in 3.2 KB. Table size grows by 4x per extra bit.
+template<int Bits = 6>
+requires (Bits >= 4 && Bits <= 8)
+[[nodiscard]] inline uint16_t atan2_lut(int16_t y, int16_t x) noexcept {
+    uint32_t abs_x = (x < 0) ? -int32_t(x) : x;
+    uint32_t abs_y = (y < 0) ? -int32_t(y) : y;
+    uint8_t quadrant_adjust = ((x < 0) << 1) | (y < 0);
+    
+    bool steep = abs_y > abs_x;
+    uint32_t major = steep ? abs_y : abs_x;
+    uint32_t minor = steep ? abs_x : abs_y;
+    if (major == 0) {
+        return 0;
+    }
+    
+    int shift = (32 - __builtin_clz(major)) - Bits;
+    if (shift > 0) {
+        uint32_t round = 1u << (shift - 1);
+        major = (major + round) >> shift;
+        minor = (minor + round) >> shift;
+    } else {
+        major <<= -shift;
+        minor <<= -shift;
+    }
+    
+    constexpr uint32_t HALF = 1u << (Bits - 1);
+    uint32_t row = (major * (major + 1) - HALF * (HALF + 1)) >> 1;
+    uint16_t angle = detail::atan2_octant_table<Bits>[row + minor];
+    
+    return detail::unfold_quadrant(steep ? 4096 - angle : angle, quadrant_adjust);
+}
+
+template<int Bits = 6>
+requires (Bits >= 4 && Bits <= 8)
+constexpr std::size_t atan2_lut_memory() {
+    return sizeof(detail::atan2_octant_table<Bits>);
+}
+
+// ============================================================
+// Helper classes for common operations
+// ============================================================
+
+template<typename TrigImpl = Trig>
+class Rotor;
+
+// 2D vectors in int16 coordinates: single points, and SoA batches over
+// spans of x and y arrays
+template<typename TrigImpl = Trig>
+class Vector2D {
+public:
+    struct Vec2 {
+        int16_t x, y;
+    };
+    
+    struct Polar {
+        uint16_t angle;
+        int16_t magnitude;
+    };
+    
+    [[nodiscard]] static Polar to_polar(const Vec2& v) noexcept {
+        auto polar = TrigImpl::to_polar(v.x, v.y);
+        int32_t magnitude = (polar.magnitude < 32767) ? polar.magnitude : 32767;
+        return {polar.angle, static_cast<int16_t>(magnitude)};
+    }
+    
+    [[nodiscard]] static Vec2 from_polar(const Polar& p) noexcept {
+        Q14 cos_a, sin_a;
+        TrigImpl::sincos(p.angle, sin_a, cos_a);
+        Coord magnitude(p.magnitude);
+        
+        return {
+            fixed_cast<Coord>(magnitude * cos_a).raw(),
+            fixed_cast<Coord>(magnitude * sin_a).raw()
+        };
+    }
+    
+    [[nodiscard]] static Vec2 rotate(const Vec2& v, uint16_t angle) noexcept {
+        Q14 cos_a, sin_a;
+        TrigImpl::sincos(angle, sin_a, cos_a);
+        Coord x(v.x), y(v.y);
+        
+        return {
+            fixed_cast<Coord>(x * cos_a - y * sin_a).raw(),
+            fixed_cast<Coord>(x * sin_a + y * cos_a).raw()
+        };
+    }
+    
+    // ============================================================
+    // SoA batches: bit-exact with the single-point functions. Each
+    // processes the shortest of its spans; outputs may alias inputs.
+    // ============================================================
+    
+    // Fixed-capacity SoA storage (no heap); the first `count` entries are used
+    template<std::size_t Capacity>
+    struct Vec2Array {
+        alignas(32) std::array<int16_t, Capacity> x{};
+        alignas(32) std::array<int16_t, Capacity> y{};
+        std::size_t count = 0;
+        
+        [[nodiscard]] std::span<int16_t> xs() noexcept { return {x.data(), count}; }
+        [[nodiscard]] std::span<int16_t> ys() noexcept { return {y.data(), count}; }
+        [[nodiscard]] std::span<const int16_t> xs() const noexcept { return {x.data(), count}; }
+        [[nodiscard]] std::span<const int16_t> ys() const noexcept { return {y.data(), count}; }
+    };
+    
+    template<std::size_t Capacity>
+    struct PolarArray {
+        alignas(32) std::array<uint16_t, Capacity> angle{};
+        alignas(32) std::array<int16_t, Capacity> magnitude{};
+        std::size_t count = 0;
+        
+        [[nodiscard]] std::span<uint16_t> angles() noexcept { return {angle.data(), count}; }
+        [[nodiscard]] std::span<int16_t> magnitudes() noexcept { return {magnitude.data(), count}; }
+        [[nodiscard]] std::span<const uint16_t> angles() const noexcept { return {angle.data(), count}; }
+        [[nodiscard]] std::span<const int16_t> magnitudes() const noexcept { return {magnitude.data(), count}; }
+    };
+    
+    // Through TrigImpl::to_polar_batch (AVX2 CORDIC for IntegerTrig), in
+    // blocks so the int32 magnitudes stay on the stack
+    static void to_polar(std::span<const int16_t> xs, std::span<const int16_t> ys,
+                         std::span<uint16_t> angles, std::span<int16_t> magnitudes) noexcept {
+        std::size_t count = std::min({xs.size(), ys.size(), angles.size(), magnitudes.size()});
+        int32_t wide[BATCH_BLOCK];
+        for (std::size_t start = 0; start < count; start += BATCH_BLOCK) {
+            std::size_t n = std::min(BATCH_BLOCK, count - start);
+            TrigImpl::to_polar_batch(xs.subspan(start, n), ys.subspan(start, n),
+                                     angles.subspan(start, n), std::span<int32_t>(wide, n));
+            for (std::size_t i = 0; i < n; ++i) {
+                magnitudes[start + i] = static_cast<int16_t>(std::min(wide[i], int32_t(32767)));
+            }
+        }
+    }
+    
+    // Through TrigImpl::sincos_batch; the scaling loop autovectorises
+    static void from_polar(std::span<const uint16_t> angles, std::span<const int16_t> magnitudes,
+                           std::span<int16_t> xs, std::span<int16_t> ys) noexcept {
+        std::size_t count = std::min({angles.size(), magnitudes.size(), xs.size(), ys.size()});
+        int16_t sin_a[BATCH_BLOCK], cos_a[BATCH_BLOCK];
+        for (std::size_t start = 0; start < count; start += BATCH_BLOCK) {
+            std::size_t n = std::min(BATCH_BLOCK, count - start);
+            TrigImpl::sincos_batch(angles.subspan(start, n), std::span<int16_t>(sin_a, n),
+                                   std::span<int16_t>(cos_a, n));
+            const int16_t* m = magnitudes.data() + start;
+            int16_t* x = xs.data() + start;
+            int16_t* y = ys.data() + start;
+            for (std::size_t i = 0; i < n; ++i) {
+                Coord magnitude(m[i]);
+                x[i] = fixed_cast<Coord>(magnitude * Q14::from_raw(cos_a[i])).raw();
+                y[i] = fixed_cast<Coord>(magnitude * Q14::from_raw(sin_a[i])).raw();
+            }
+        }
+    }
+    
+    // One sin/cos lookup for the whole batch (see Rotor)
+    static void rotate(std::span<const int16_t> xs, std::span<const int16_t> ys, uint16_t angle,
+                       std::span<int16_t> x_out, std::span<int16_t> y_out) noexcept {
+        Rotor<TrigImpl>(Angle14::from_raw(angle)).apply(xs, ys, x_out, y_out);
+    }
+    
+    // Wraps like int16_t arithmetic
+    static void translate(std::span<const int16_t> xs, std::span<const int16_t> ys, Vec2 offset,
+                          std::span<int16_t> x_out, std::span<int16_t> y_out) noexcept {
+        std::size_t count = std::min({xs.size(), ys.size(), x_out.size(), y_out.size()});
+        const int16_t* px = xs.data();
+        const int16_t* py = ys.data();
+        int16_t* qx = x_out.data();
+        int16_t* qy = y_out.data();
+        for (std::size_t i = 0; i < count; ++i) {
+            qx[i] = static_cast<int16_t>(px[i] + offset.x);
+            qy[i] = static_cast<int16_t>(py[i] + offset.y);
+        }
+    }
+    
+    template<std::size_t Capacity>
+    static void to_polar(const Vec2Array<Capacity>& points, PolarArray<Capacity>& polar) noexcept {
+        polar.count = points.count;
+        to_polar(points.xs(), points.ys(), polar.angles(), polar.magnitudes());
+    }
+    
+    template<std::size_t Capacity>
+    static void from_polar(const PolarArray<Capacity>& polar, Vec2Array<Capacity>& points) noexcept {
+        points.count = polar.count;
+        from_polar(polar.angles(), polar.magnitudes(), points.xs(), points.ys());
+    }
+
+private:
+    // Coordinates as Q15.0; products with Q1.14 are Q17.14 in 32 bits
+    using Coord = Fixed<15, 0, int16_t>;
+    
+    // Stack buffer length for the blocked batches
+    static constexpr std::size_t BATCH_BLOCK = 256;
+};
+
+// Rotation by one angle, with sin and cos looked up once. Applying it is
+// bit-exact with Vector2D::rotate, so rotating N points costs one table
+// lookup and 4N multiplies.
+template<typename TrigImpl>
+class Rotor {
+public:
+    using Vec2 = typename Vector2D<TrigImpl>::Vec2;
+
+    // Identity
+    constexpr Rotor() noexcept : sin_(Q14::from_raw(0)), cos_(Q14::from_raw(16384)) {}
+
+    explicit constexpr Rotor(Angle14 angle) noexcept {
+        TrigImpl::sincos(angle, sin_, cos_);
+    }
+
+    // Both within ±1.0
+    [[nodiscard]] static constexpr Rotor from_sincos(Q14 sin_value, Q14 cos_value) noexcept {
+        Rotor result;
+        result.sin_ = sin_value;
+        result.cos_ = cos_value;
+        return result;
+    }
+
+    [[nodiscard]] constexpr Q14 sin() const noexcept { return sin_; }
+    [[nodiscard]] constexpr Q14 cos() const noexcept { return cos_; }
+
+    // Angle addition by the product formula, no table lookup. Lengths
+    // multiply: table sin/cos pairs are within a few LSB of unit length, so
+    // renormalize() chains of more than a few dozen compositions.
+    friend constexpr Rotor operator*(Rotor a, Rotor b) noexcept {
+        return from_sincos(
+            fixed_cast<Q14, RoundNearest>(a.sin_ * b.cos_ + a.cos_ * b.sin_),
+            fixed_cast<Q14, RoundNearest>(a.cos_ * b.cos_ - a.sin_ * b.sin_));
+    }
+
+    constexpr Rotor& operator*=(Rotor other) noexcept { return *this = *this * other; }
+
+    // Rotation by the negated angle (exact)
+    [[nodiscard]] constexpr Rotor inverse() const noexcept { return from_sincos(-sin_, cos_); }
+
+    // One Newton step toward unit length: scale by (3 - |r|²) / 2
+    [[nodiscard]] constexpr Rotor renormalize() const noexcept {
+        auto half_length_sq = Fixed<2, 29>::from_raw((sin_ * sin_ + cos_ * cos_).raw());
+        auto scale = Fixed<2, 29>(Q14(1.5)) - half_length_sq;
+        return from_sincos(fixed_cast<Q14, RoundNearest>(scale * sin_),
+                           fixed_cast<Q14, RoundNearest>(scale * cos_));
+    }
+
+    [[nodiscard]] constexpr Vec2 rotate(Vec2 v) const noexcept {
+        Coord x(v.x), y(v.y);
+        return {
+            fixed_cast<Coord>(x * cos_ - y * sin_).raw(),
+            fixed_cast<Coord>(x * sin_ + y * cos_).raw()
+        };
+    }
+
+    // Rotate an array of points (AoS); out may alias in.
+    // Processes min(in.size(), out.size()) points
+    void apply(std::span<const Vec2> in, std::span<Vec2> out) const noexcept {
+        const Vec2* src = in.data();
+        Vec2* dst = out.data();
+        std::size_t count = std::min(in.size(), out.size());
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        i = count & ~std::size_t(7);
+        apply_aos_avx2(src, dst, i);
+#elif defined(__SSE4_1__)
+        i = count & ~std::size_t(3);
+        apply_aos_sse41(src, dst, i);
+#endif
+        for (; i < count; ++i) {
+            dst[i] = rotate(src[i]);
+        }
+    }
+
+    // Rotate SoA coordinates; the outputs may alias the inputs.
+    // Processes the shortest of the four spans
+    void apply(std::span<const int16_t> xs, std::span<const int16_t> ys,
+               std::span<int16_t> x_out, std::span<int16_t> y_out) const noexcept {
+        std::size_t count = std::min({xs.size(), ys.size(), x_out.size(), y_out.size()});
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        i = count & ~std::size_t(15);
+        apply_soa_avx2(xs.data(), ys.data(), x_out.data(), y_out.data(), i);
+#elif defined(__SSE4_1__)
+        i = count & ~std::size_t(7);
+        apply_soa_sse41(xs.data(), ys.data(), x_out.data(), y_out.data(), i);
+#endif
+        for (; i < count; ++i) {
+            Vec2 r = rotate({xs[i], ys[i]});
+            x_out[i] = r.x;
+            y_out[i] = r.y;
+        }
+    }
+
+private:
+    using Coord = Fixed<15, 0, int16_t>;
+
+    // pmaddwd coefficient pairs: (x, y)·(cos, -sin) and (x, y)·(sin, cos)
+    constexpr int32_t x_pair() const noexcept {
+        return int32_t(uint16_t(cos_.raw()) | (uint32_t(uint16_t(-sin_.raw())) << 16));
+    }
+    constexpr int32_t y_pair() const noexcept {
+        return int32_t(uint16_t(sin_.raw()) | (uint32_t(uint16_t(cos_.raw())) << 16));
+    }
+
+    Q14 sin_;
+    Q14 cos_;
+
+    // The products are exact in 32 bits; >> 14 then keeping the low 16 bits
+    // matches fixed_cast (floor, wrap) in rotate()
+#if defined(__AVX2__)
+    static __m256i low16_avx2(__m256i v) noexcept {
+        return _mm256_srai_epi32(_mm256_slli_epi32(_mm256_srai_epi32(v, 14), 16), 16);
+    }
+
+    // count must be a multiple of 8
+    void apply_aos_avx2(const Vec2* in, Vec2* out, std::size_t count) const noexcept {
+        const __m256i x_coeff = _mm256_set1_epi32(x_pair());
+        const __m256i y_coeff = _mm256_set1_epi32(y_pair());
+        for (std::size_t i = 0; i < count; i += 8) {
+            __m256i xy = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+            __m256i x = _mm256_srai_epi32(_mm256_madd_epi16(xy, x_coeff), 14);
+            __m256i y = _mm256_slli_epi32(_mm256_srai_epi32(_mm256_madd_epi16(xy, y_coeff), 14), 16);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_blend_epi16(x, y, 0xAA));
+        }
+    }
+
+    // count must be a multiple of 16
+    void apply_soa_avx2(const int16_t* xs, const int16_t* ys, int16_t* x_out, int16_t* y_out,
+                        std::size_t count) const noexcept {
+        const __m256i x_coeff = _mm256_set1_epi32(x_pair());
+        const __m256i y_coeff = _mm256_set1_epi32(y_pair());
+        for (std::size_t i = 0; i < count; i += 16) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(xs + i));
+            __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ys + i));
+            // In-lane interleave; packs undoes the same in-lane order
+            __m256i lo = _mm256_unpacklo_epi16(x, y);
+            __m256i hi = _mm256_unpackhi_epi16(x, y);
+            __m256i rx = _mm256_packs_epi32(low16_avx2(_mm256_madd_epi16(lo, x_coeff)),
+                                            low16_avx2(_mm256_madd_epi16(hi, x_coeff)));
+            __m256i ry = _mm256_packs_epi32(low16_avx2(_mm256_madd_epi16(lo, y_coeff)),
+                                            low16_avx2(_mm256_madd_epi16(hi, y_coeff)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(x_out + i), rx);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(y_out + i), ry);
+        }
+    }
+#elif defined(__SSE4_1__)
+    static __m128i low16_sse41(__m128i v) noexcept {
+        return _mm_srai_epi32(_mm_slli_epi32(_mm_srai_epi32(v, 14), 16), 16);
+    }
+
+    // count must be a multiple of 4
+    void apply_aos_sse41(const Vec2* in, Vec2* out, std::size_t count) const noexcept {
+        const __m128i x_coeff = _mm_set1_epi32(x_pair());
+        const __m128i y_coeff = _mm_set1_epi32(y_pair());
+        for (std::size_t i = 0; i < count; i += 4) {
+            __m128i xy = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            __m128i x = _mm_srai_epi32(_mm_madd_epi16(xy, x_coeff), 14);
+            __m128i y = _mm_slli_epi32(_mm_srai_epi32(_mm_madd_epi16(xy, y_coeff), 14), 16);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_blend_epi16(x, y, 0xAA));
+        }
+    }
+
+    // count must be a multiple of 8
+    void apply_soa_sse41(const int16_t* xs, const int16_t* ys, int16_t* x_out, int16_t* y_out,
+                         std::size_t count) const noexcept {
+        const __m128i x_coeff = _mm_set1_epi32(x_pair());
+        const __m128i y_coeff = _mm_set1_epi32(y_pair());
+        for (std::size_t i = 0; i < count; i += 8) {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(xs + i));
+            __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ys + i));
+            __m128i lo = _mm_unpacklo_epi16(x, y);
+            __m128i hi = _mm_unpackhi_epi16(x, y);
+            __m128i rx = _mm_packs_epi32(low16_sse41(_mm_madd_epi16(lo, x_coeff)),
+                                         low16_sse41(_mm_madd_epi16(hi, x_coeff)));
+            __m128i ry = _mm_packs_epi32(low16_sse41(_mm_madd_epi16(lo, y_coeff)),
+                                         low16_sse41(_mm_madd_epi16(hi, y_coeff)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(x_out + i), rx);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(y_out + i), ry);
+        }
+    }
+#endif
+};
 
 // Angle conversion utilities
 class AngleConvert {
 public:
-    // Convert degrees to internal angle units
+    // Convert degrees to internal angle units, rounded; any sign or number
+    // of turns
     [[nodiscard]] static constexpr uint16_t from_degrees(int16_t degrees) noexcept {
-        // Handle negative degrees
-        while (degrees < 0) degrees += 360;
-        while (degrees >= 360) degrees -= 360;
-        
-        // Convert: 360° = 16384 units
-        return (static_cast<uint32_t>(degrees) * 16384) / 360;
+        return Angle14(Degrees(degrees)).raw();
     }
     
     // Convert radians (fixed-point) to internal angle units
     // Input: radians * 1000 (e.g., 3141 = 3.141 radians)
     [[nodiscard]] static constexpr uint16_t from_milliradians(int32_t mrad) noexcept {
-        // 2π radians = 16384 units
-        // 6283 milliradians = 16384 units
-        return (static_cast<uint32_t>(mrad) * 16384) / 6283;
+        return Angle14(Milliradians(mrad)).raw();
     }
     
     // Convert internal units to degrees
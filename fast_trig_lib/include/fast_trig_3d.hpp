@@ -0,0 +1,359 @@
+// fast_trig_3d.hpp - Fixed-point 3-D rotations on top of FastTrig
+// Version: 1.0.0
+// License: MIT
+//
+// Vectors, quaternions and rotation matrices for attitude estimation on
+// cores without an FPU. Angles are Angle14 (16384 per turn), vector
+// components int16, matrix elements Q14; sin and cos come from
+// TrigImpl::sincos. Euler angles follow the aerospace Z-Y-X convention:
+// yaw about z, then pitch about y, then roll about x.
+
+#ifndef FAST_TRIG_3D_HPP
+#define FAST_TRIG_3D_HPP
+
+#include "fast_trig.hpp"
+
+namespace FastTrig {
+
+namespace detail {
+
+// Linear seed for 1/sqrt(m), m in [1, 4), in Q30: 1.1 - 0.162·m
+inline constexpr uint64_t INVERSE_SQRT_SEED_A = 1181116006;   // 1.1
+inline constexpr uint64_t INVERSE_SQRT_SEED_B = 173946175;    // 0.162
+
+// 1/sqrt(value / 2^frac_bits) in Q30, for value / 2^frac_bits >= 2^-60.
+// Normalises to a mantissa m in [1, 4), seeds linearly (10% error) and
+// refines with three Newton steps y·(3 - m·y²)/2: relative error below
+// 3e-7. No table and no division.
+constexpr uint64_t inverse_sqrt_q30(uint64_t value, int frac_bits) noexcept {
+    if (value == 0) {
+        return UINT64_MAX;
+    }
+    // Shift so the top bit lands on 30 or 31, keeping the exponent even
+    int k = (63 - __builtin_clzll(value)) - 30;
+    if ((k - frac_bits) & 1) {
+        k -= 1;
+    }
+    uint64_t m = (k >= 0) ? value >> k : value << -k;
+
+    uint64_t y = INVERSE_SQRT_SEED_A - ((INVERSE_SQRT_SEED_B * m) >> 30);
+    for (int step = 0; step < 3; ++step) {
+        uint64_t m_y2 = (m * ((y * y) >> 30)) >> 30;
+        y = (y * ((uint64_t(3) << 30) - m_y2)) >> 31;
+    }
+
+    // 1/sqrt(v) = y · 2^-(k + 30 - frac_bits)/2
+    int shift = (k + 30 - frac_bits) / 2;
+    return (shift >= 0) ? (y + ((uint64_t(1) << shift) >> 1)) >> shift : y << -shift;
+}
+
+} // namespace detail
+
+// Euler angles, Z-Y-X (yaw, then pitch, then roll)
+struct EulerAngles {
+    Angle14 roll;
+    Angle14 pitch;
+    Angle14 yaw;
+};
+
+// ============================================================
+// Vectors
+// ============================================================
+
+class Vector3D {
+public:
+    struct Vec3 {
+        int16_t x, y, z;
+
+        constexpr bool operator==(const Vec3&) const = default;
+    };
+
+    // Exact cross products; components of ±32767 or less cannot overflow
+    struct Vec3Wide {
+        int32_t x, y, z;
+    };
+
+    [[nodiscard]] static constexpr int64_t dot(Vec3 a, Vec3 b) noexcept {
+        return int64_t(int32_t(a.x) * b.x) + int32_t(a.y) * b.y + int64_t(int32_t(a.z) * b.z);
+    }
+
+    [[nodiscard]] static constexpr Vec3Wide cross(Vec3 a, Vec3 b) noexcept {
+        return {int32_t(a.y) * b.z - int32_t(a.z) * b.y,
+                int32_t(a.z) * b.x - int32_t(a.x) * b.z,
+                int32_t(a.x) * b.y - int32_t(a.y) * b.x};
+    }
+
+    // floor(sqrt(x² + y² + z²)); the sum fits 32 bits
+    [[nodiscard]] static constexpr uint32_t magnitude(Vec3 v) noexcept {
+        return detail::isqrt32(static_cast<uint32_t>(dot(v, v)));
+    }
+
+    // Unit vector in Q14 (length 16384); the zero vector stays zero
+    [[nodiscard]] static constexpr Vec3 normalize(Vec3 v) noexcept {
+        uint64_t length_sq = static_cast<uint64_t>(dot(v, v));
+        if (length_sq == 0) {
+            return v;
+        }
+        // 2^14 / |v| in Q30
+        int64_t scale = static_cast<int64_t>(detail::inverse_sqrt_q30(length_sq, 28));
+        auto unit = [scale](int16_t c) {
+            return static_cast<int16_t>((c * scale + (int64_t(1) << 29)) >> 30);
+        };
+        return {unit(v.x), unit(v.y), unit(v.z)};
+    }
+};
+
+// ============================================================
+// Quaternions
+// ============================================================
+
+// Rotation quaternion with Q fraction bits per component: Quaternion<14>
+// packs into 4 x int16, Quaternion<30> into 4 x int32 for long
+// integrations. Products round to nearest. Components stay within ±1 for a
+// unit quaternion; call normalized() after repeated products.
+template<int Q = 14>
+requires (Q >= 8 && Q <= 30)
+class Quaternion {
+public:
+    using Component = Fixed<1, Q>;
+    using Vec3 = Vector3D::Vec3;
+
+    Component w, x, y, z;
+
+    [[nodiscard]] static constexpr Quaternion identity() noexcept {
+        return {Component::from_raw(typename Component::storage_type(1) << Q),
+                Component::from_raw(0), Component::from_raw(0), Component::from_raw(0)};
+    }
+
+    // Half angles fall between table angles when the angle is odd; their
+    // sin and cos are the mean of the two neighbours (in Q15), which is
+    // within 5e-8 of exact, so this costs two sincos per angle. Table sin
+    // and cos pairs are not exactly unit length, so the result is
+    // normalized.
+    template<typename TrigImpl = Trig>
+    [[nodiscard]] static Quaternion from_euler(EulerAngles euler) noexcept {
+        Half sr, cr, sp, cp, sy, cy;
+        half_sincos<TrigImpl>(euler.roll, sr, cr);
+        half_sincos<TrigImpl>(euler.pitch, sp, cp);
+        half_sincos<TrigImpl>(euler.yaw, sy, cy);
+
+        auto cpcy = cp * cy, spsy = sp * sy, spcy = sp * cy, cpsy = cp * sy;
+        Quaternion q{round(cr * cpcy + sr * spsy), round(sr * cpcy - cr * spsy),
+                     round(cr * spcy + sr * cpsy), round(cr * cpsy - sr * spcy)};
+        return q.normalized();
+    }
+
+    // Rotation by `angle` about a Q14 unit axis
+    template<typename TrigImpl = Trig>
+    [[nodiscard]] static Quaternion from_axis_angle(Vec3 axis, Angle14 angle) noexcept {
+        Half s, c;
+        half_sincos<TrigImpl>(angle, s, c);
+        Quaternion q{round(c), round(Q14::from_raw(axis.x) * s),
+                     round(Q14::from_raw(axis.y) * s), round(Q14::from_raw(axis.z) * s)};
+        return q.normalized();
+    }
+
+    // Through TrigImpl::atan2 and asin, so as accurate as those (about 1
+    // unit); pitch saturates at ±90°
+    template<typename TrigImpl = Trig>
+    [[nodiscard]] EulerAngles to_euler() const noexcept {
+        int64_t qw = w.raw(), qx = x.raw(), qy = y.raw(), qz = z.raw();
+        constexpr int64_t one = int64_t(1) << (2 * Q);
+
+        // Both atan2 arguments brought to Q13, so a unit quaternion fits int16
+        auto q13 = [](int64_t v) { return static_cast<int16_t>(v >> (2 * Q - 13)); };
+        int64_t sin_pitch = (2 * (qw * qy - qz * qx)) >> (2 * Q - 14);
+        sin_pitch = std::clamp<int64_t>(sin_pitch, -16384, 16384);
+
+        return {
+            Angle14::from_raw(TrigImpl::atan2(q13(2 * (qw * qx + qy * qz)),
+                                              q13(one - 2 * (qx * qx + qy * qy)))),
+            Angle14::from_raw(TrigImpl::asin(static_cast<int16_t>(sin_pitch))),
+            Angle14::from_raw(TrigImpl::atan2(q13(2 * (qw * qz + qx * qy)),
+                                              q13(one - 2 * (qy * qy + qz * qz))))
+        };
+    }
+
+    // Hamilton product: rotation by b, then by a
+    friend constexpr Quaternion operator*(Quaternion a, Quaternion b) noexcept {
+        return {round(a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z),
+                round(a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y),
+                round(a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x),
+                round(a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w)};
+    }
+
+    constexpr Quaternion& operator*=(Quaternion other) noexcept { return *this = *this * other; }
+
+    // Inverse rotation of a unit quaternion (exact)
+    [[nodiscard]] constexpr Quaternion conjugate() const noexcept { return {w, -x, -y, -z}; }
+
+    // Scale to unit length with the integer inverse square root. Meant for
+    // drift near unit length; far below it the products overflow
+    [[nodiscard]] constexpr Quaternion normalized() const noexcept {
+        int64_t qw = w.raw(), qx = x.raw(), qy = y.raw(), qz = z.raw();
+        uint64_t norm_sq = static_cast<uint64_t>(qw * qw + qx * qx + qy * qy + qz * qz);
+        if (norm_sq == 0) {
+            return identity();
+        }
+        int64_t scale = static_cast<int64_t>(detail::inverse_sqrt_q30(norm_sq, 2 * Q));
+        auto unit = [scale](Component c) {
+            return Component::from_raw(static_cast<typename Component::storage_type>(
+                (c.raw() * scale + (int64_t(1) << 29)) >> 30));
+        };
+        return {unit(w), unit(x), unit(y), unit(z)};
+    }
+
+    constexpr bool operator==(const Quaternion&) const = default;
+
+private:
+    // Q15 sine or cosine of a half angle: the sum of two Q14 table values
+    using Half = Fixed<1, 15, int32_t>;
+
+    template<typename TrigImpl>
+    static void half_sincos(Angle14 angle, Half& sin_out, Half& cos_out) noexcept {
+        Q14 s0, c0, s1, c1;
+        TrigImpl::sincos(Angle14::from_raw(angle.raw() >> 1), s0, c0);
+        TrigImpl::sincos(Angle14::from_raw((angle.raw() + 1u) >> 1), s1, c1);
+        sin_out = Half::from_raw(int32_t(s0.raw()) + s1.raw());
+        cos_out = Half::from_raw(int32_t(c0.raw()) + c1.raw());
+    }
+
+    template<int I, int F, typename S>
+    static constexpr Component round(Fixed<I, F, S> value) noexcept {
+        return fixed_cast<Component, RoundNearest>(value);
+    }
+};
+
+// ============================================================
+// Rotation matrices
+// ============================================================
+
+// 3x3 rotation matrix in Q14, row-major. Building one costs one quaternion
+// or three sincos; applying it costs 9 multiplies per vector, so batches
+// should convert once. apply() rounds to nearest and wraps like int16_t.
+class Rot3 {
+public:
+    using Vec3 = Vector3D::Vec3;
+
+    std::array<Q14, 9> m;
+
+    [[nodiscard]] static constexpr Rot3 identity() noexcept {
+        Rot3 r{};
+        r.m.fill(Q14::from_raw(0));
+        r.m[0] = r.m[4] = r.m[8] = Q14::from_raw(16384);
+        return r;
+    }
+
+    template<int Q>
+    [[nodiscard]] static constexpr Rot3 from_quaternion(const Quaternion<Q>& q) noexcept {
+        using Wide = Fixed<3, 2 * Q>;
+        const Wide one = Q14(1.0);
+        auto twice = [](Wide v) { return v + v; };
+        auto round = [](Wide v) { return fixed_cast<Q14, RoundNearest>(v); };
+
+        Wide xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+        Wide xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+        Wide wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+        return {{round(one - twice(yy + zz)), round(twice(xy - wz)), round(twice(xz + wy)),
+                 round(twice(xy + wz)), round(one - twice(xx + zz)), round(twice(yz - wx)),
+                 round(twice(xz - wy)), round(twice(yz + wx)), round(one - twice(xx + yy))}};
+    }
+
+    // Rz(yaw) · Ry(pitch) · Rx(roll), from three sincos
+    template<typename TrigImpl = Trig>
+    [[nodiscard]] static Rot3 from_euler(EulerAngles euler) noexcept {
+        Q14 sr, cr, sp, cp, sy, cy;
+        TrigImpl::sincos(euler.roll, sr, cr);
+        TrigImpl::sincos(euler.pitch, sp, cp);
+        TrigImpl::sincos(euler.yaw, sy, cy);
+        using Wide = Fixed<5, 42>;
+        auto round = [](auto v) { return fixed_cast<Q14, RoundNearest>(v); };
+
+        auto cysp = cy * sp, sysp = sy * sp;
+        return {{round(cy * cp), round(cysp * sr - Wide(sy * cr)), round(cysp * cr + Wide(sy * sr)),
+                 round(sy * cp), round(sysp * sr + Wide(cy * cr)), round(sysp * cr - Wide(cy * sr)),
+                 -sp, round(cp * sr), round(cp * cr)}};
+    }
+
+    // Inverse rotation (exact)
+    [[nodiscard]] constexpr Rot3 transpose() const noexcept {
+        return {{m[0], m[3], m[6], m[1], m[4], m[7], m[2], m[5], m[8]}};
+    }
+
+    friend constexpr Rot3 operator*(const Rot3& a, const Rot3& b) noexcept {
+        Rot3 r{};
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                r.m[3 * i + j] = fixed_cast<Q14, RoundNearest>(
+                    a.m[3 * i] * b.m[j] + a.m[3 * i + 1] * b.m[3 + j] + a.m[3 * i + 2] * b.m[6 + j]);
+            }
+        }
+        return r;
+    }
+
+    [[nodiscard]] constexpr Vec3 apply(Vec3 v) const noexcept {
+        return {row(0, v.x, v.y, v.z), row(1, v.x, v.y, v.z), row(2, v.x, v.y, v.z)};
+    }
+
+    // Batches, in stack blocks so the loop vectorises whatever the spans
+    // alias; outputs may be the inputs. Process the shortest of the spans
+    void apply(std::span<const Vec3> in, std::span<Vec3> out) const noexcept {
+        std::size_t count = std::min(in.size(), out.size());
+        int16_t x[BATCH_BLOCK], y[BATCH_BLOCK], z[BATCH_BLOCK];
+        for (std::size_t start = 0; start < count; start += BATCH_BLOCK) {
+            std::size_t n = std::min(BATCH_BLOCK, count - start);
+            for (std::size_t i = 0; i < n; ++i) {
+                x[i] = in[start + i].x;
+                y[i] = in[start + i].y;
+                z[i] = in[start + i].z;
+            }
+            apply_block(x, y, z, n);
+            for (std::size_t i = 0; i < n; ++i) {
+                out[start + i] = {x[i], y[i], z[i]};
+            }
+        }
+    }
+
+    void apply(std::span<const int16_t> xs, std::span<const int16_t> ys, std::span<const int16_t> zs,
+               std::span<int16_t> x_out, std::span<int16_t> y_out, std::span<int16_t> z_out) const noexcept {
+        std::size_t count = std::min({xs.size(), ys.size(), zs.size(), x_out.size(), y_out.size(), z_out.size()});
+        int16_t x[BATCH_BLOCK], y[BATCH_BLOCK], z[BATCH_BLOCK];
+        for (std::size_t start = 0; start < count; start += BATCH_BLOCK) {
+            std::size_t n = std::min(BATCH_BLOCK, count - start);
+            std::copy_n(xs.data() + start, n, x);
+            std::copy_n(ys.data() + start, n, y);
+            std::copy_n(zs.data() + start, n, z);
+            apply_block(x, y, z, n);
+            std::copy_n(x, n, x_out.data() + start);
+            std::copy_n(y, n, y_out.data() + start);
+            std::copy_n(z, n, z_out.data() + start);
+        }
+    }
+
+private:
+    using Coord = Fixed<15, 0, int16_t>;
+
+    // Q17.14 sum of three exact products, fits 32 bits
+    constexpr int16_t row(int i, int16_t x, int16_t y, int16_t z) const noexcept {
+        return fixed_cast<Coord, RoundNearest>(
+            Coord(x) * m[3 * i] + Coord(y) * m[3 * i + 1] + Coord(z) * m[3 * i + 2]).raw();
+    }
+
+    static constexpr std::size_t BATCH_BLOCK = 256;
+
+    // In place on one stack block; nothing else can alias it
+    void apply_block(int16_t* x, int16_t* y, int16_t* z, std::size_t n) const noexcept {
+        const Rot3 r = *this;
+        for (std::size_t i = 0; i < n; ++i) {
+            int16_t vx = x[i], vy = y[i], vz = z[i];
+            x[i] = r.row(0, vx, vy, vz);
+            y[i] = r.row(1, vx, vy, vz);
+            z[i] = r.row(2, vx, vy, vz);
+        }
+    }
+};
+
+} // namespace FastTrig
+
+#endif // FAST_TRIG_3D_HPP
@@ -0,0 +1,169 @@
+// fast_trig_angle.hpp - Typed angles for FastTrig
+// Version: 1.0.0
+// License: MIT
+//
+// Angle<TurnBits> is a binary angle: one turn is 2^TurnBits, and arithmetic
+// wraps modulo a turn. IntegerTrig and PolyTrig work in Angle<14> (16384
+// per turn), IntegerTrig32 in Angle<32>, and a u16 AEM angle is Angle<16>.
+// Degrees and Milliradians tag plain integers with their unit, so an angle
+// cannot be passed where another unit is expected:
+//   - a narrower binary angle converts implicitly (left shift); a wider one
+//     goes through angle_cast (rounded right shift);
+//   - Degrees and Milliradians convert with one wrapping 64-bit multiply and
+//     a shift, with no loops or division; a constant argument folds at
+//     compile time;
+//   - there is no conversion from a bare integer, use from_raw.
+
+#ifndef FAST_TRIG_ANGLE_HPP
+#define FAST_TRIG_ANGLE_HPP
+
+#include <cstdint>
+#include <concepts>
+#include <type_traits>
+
+#include "fast_trig_fixed.hpp"
+
+namespace FastTrig {
+
+// Whole degrees, any sign or number of turns
+struct Degrees {
+    int32_t value;
+    explicit constexpr Degrees(int32_t degrees) noexcept : value(degrees) {}
+    friend constexpr Degrees operator-(Degrees d) noexcept { return Degrees(-d.value); }
+};
+
+// Whole milliradians (1/1000 rad), any sign or number of turns
+struct Milliradians {
+    int32_t value;
+    explicit constexpr Milliradians(int32_t milliradians) noexcept : value(milliradians) {}
+    friend constexpr Milliradians operator-(Milliradians m) noexcept { return Milliradians(-m.value); }
+};
+
+namespace detail {
+
+// Raw units per input unit in Q32: round(2^(Bits+32) / units_per_turn).
+// A wrapping multiply keeps the low Bits+32 bits of the product, which is
+// all a modulo-turn result needs, so any int32 input works.
+template<int Bits>
+inline constexpr uint64_t per_degree_q32 = ((uint64_t(1) << (Bits + 29)) + 22) / 45;
+
+template<int Bits>
+inline constexpr uint64_t per_milliradian_q32 =
+    uint64_t(double(uint64_t(1) << (Bits + 31)) / (1000.0 * 3.14159265358979323846) + 0.5);
+
+// Milliradians per raw unit in Q(51 - Bits); raw * this stays below 2^64
+template<int Bits>
+inline constexpr uint64_t milliradians_per_raw =
+    uint64_t(2000.0 * 3.14159265358979323846 * double(uint64_t(1) << (51 - Bits)) + 0.5);
+
+} // namespace detail
+
+template<int TurnBits>
+requires (TurnBits >= 8 && TurnBits <= 32)
+class Angle {
+public:
+    using storage_type = std::conditional_t<(TurnBits <= 16), uint16_t, uint32_t>;
+    static constexpr int TURN_BITS = TurnBits;
+    static constexpr storage_type MASK = static_cast<storage_type>((uint64_t(1) << TurnBits) - 1);
+
+    constexpr Angle() noexcept = default;
+
+    // Lossless conversion from a coarser binary angle
+    template<int Bits>
+    requires (Bits <= TurnBits)
+    constexpr Angle(Angle<Bits> other) noexcept
+        : raw_(static_cast<storage_type>(storage_type(other.raw()) << (TurnBits - Bits))) {}
+
+    // Rounded to the nearest raw unit; within 0.75 unit of exact for any
+    // int32 input
+    constexpr Angle(Degrees degrees) noexcept
+        : raw_(from_q32(uint64_t(int64_t(degrees.value)) * detail::per_degree_q32<TurnBits>)) {}
+
+    constexpr Angle(Milliradians mrad) noexcept
+        : raw_(from_q32(uint64_t(int64_t(mrad.value)) * detail::per_milliradian_q32<TurnBits>)) {}
+
+    // Raw value, reduced modulo one turn
+    [[nodiscard]] static constexpr Angle from_raw(uint32_t raw) noexcept {
+        Angle result;
+        result.raw_ = static_cast<storage_type>(raw & MASK);
+        return result;
+    }
+
+    [[nodiscard]] constexpr storage_type raw() const noexcept { return raw_; }
+
+    // Raw value in [-half turn, half turn), for angle errors
+    [[nodiscard]] constexpr int32_t to_signed() const noexcept {
+        constexpr int shift = 32 - TurnBits;
+        return static_cast<int32_t>(uint32_t(raw_) << shift) >> shift;
+    }
+
+    // Nearest whole degree in [0, 360)
+    [[nodiscard]] constexpr Degrees to_degrees() const noexcept {
+        uint64_t scaled = (uint64_t(raw_) * 360 + (uint64_t(1) << (TurnBits - 1))) >> TurnBits;
+        return Degrees(static_cast<int32_t>(scaled == 360 ? 0 : scaled));
+    }
+
+    // Nearest whole milliradian in [0, 6283]
+    [[nodiscard]] constexpr Milliradians to_milliradians() const noexcept {
+        return Milliradians(static_cast<int32_t>(
+            (uint64_t(raw_) * detail::milliradians_per_raw<TurnBits> + (uint64_t(1) << 50)) >> 51));
+    }
+
+    // Arithmetic wraps modulo one turn
+    friend constexpr Angle operator+(Angle a, Angle b) noexcept { return from_raw(uint32_t(a.raw_) + b.raw_); }
+    friend constexpr Angle operator-(Angle a, Angle b) noexcept { return from_raw(uint32_t(a.raw_) - b.raw_); }
+    friend constexpr Angle operator-(Angle a) noexcept { return from_raw(0u - a.raw_); }
+
+    template<std::integral I>
+    friend constexpr Angle operator*(Angle a, I n) noexcept {
+        return from_raw(uint32_t(a.raw_) * static_cast<uint32_t>(n));
+    }
+
+    constexpr Angle& operator+=(Angle other) noexcept { return *this = *this + other; }
+    constexpr Angle& operator-=(Angle other) noexcept { return *this = *this - other; }
+
+    // Equality only: angles wrap, so there is no meaningful ordering
+    friend constexpr bool operator==(Angle a, Angle b) noexcept = default;
+
+private:
+    static constexpr storage_type from_q32(uint64_t q32) noexcept {
+        return static_cast<storage_type>(((q32 + (uint64_t(1) << 31)) >> 32) & MASK);
+    }
+
+    storage_type raw_ = 0;
+};
+
+// Change binary-angle width. Widening is an exact left shift; narrowing
+// shifts right with RoundFloor or RoundNearest and wraps.
+template<typename To, typename Rounding = RoundFloor, int Bits>
+requires std::same_as<Rounding, RoundFloor> || std::same_as<Rounding, RoundNearest>
+[[nodiscard]] constexpr To angle_cast(Angle<Bits> from) noexcept {
+    constexpr int shift = Bits - To::TURN_BITS;
+    if constexpr (shift <= 0) {
+        return To(from);
+    } else if constexpr (std::same_as<Rounding, RoundNearest>) {
+        return To::from_raw(static_cast<uint32_t>((uint64_t(from.raw()) + (uint64_t(1) << (shift - 1))) >> shift));
+    } else {
+        return To::from_raw(static_cast<uint32_t>(from.raw() >> shift));
+    }
+}
+
+using Angle14 = Angle<14>;   // IntegerTrig/PolyTrig: 16384 per turn
+using Angle16 = Angle<16>;   // 65536 per turn (AEM u16 angles)
+using Angle32 = Angle<32>;   // IntegerTrig32 and 32-bit NCO phase
+
+inline namespace literals {
+
+constexpr Degrees operator""_deg(unsigned long long degrees) noexcept {
+    return Degrees(static_cast<int32_t>(degrees));
+}
+
+constexpr Milliradians operator""_mrad(unsigned long long milliradians) noexcept {
+    return Milliradians(static_cast<int32_t>(milliradians));
+}
+
+} // namespace literals
+
+} // namespace FastTrig
+
+#endif // FAST_TRIG_ANGLE_HPP
@@ -0,0 +1,685 @@
+// fast_trig_dsp.hpp - Signal processing building blocks on top of FastTrig
+// Version: 1.0.0
+// License: MIT
+//
+// Streaming, block-oriented DSP helpers that use the IntegerTrig tables.
+// All integer arithmetic, same angle and output scaling as fast_trig.hpp.
+
+#ifndef FAST_TRIG_DSP_HPP
+#define FAST_TRIG_DSP_HPP
+
+#include "fast_trig.hpp"
+#include <cassert>
+
+namespace FastTrig {
+
+// Complex sample, Q15 unless stated otherwise
+struct ComplexQ15 {
+    int16_t re;
+    int16_t im;
+    
+    constexpr bool operator==(const ComplexQ15&) const = default;
+};
+
+namespace detail {
+
+// Table output (Q14, ±16384) to Q15 twiddle, +1.0 saturating to 32767
+inline constexpr int16_t q14_to_q15(int16_t q14) {
+    int32_t v = int32_t(q14) * 2;
+    return static_cast<int16_t>(v > 32767 ? 32767 : v);
+}
+
+// Sine and cosine of a 14-bit angle in Q30 from the table-generation series
+// For coefficients where Q14 table output is too coarse
+constexpr void sincos_q30(uint16_t angle, int32_t& s, int32_t& c) {
+    angle &= 0x3FFF;
+    int64_t offset = angle & 0x0FFF;
+    int64_t a = sin_q30(offset << 8);
+    int64_t b = sin_q30((4096 - offset) << 8);
+    switch (angle >> 12) {
+        case 0:  s = int32_t(a);  c = int32_t(b);  break;
+        case 1:  s = int32_t(b);  c = int32_t(-a); break;
+        case 2:  s = int32_t(-a); c = int32_t(-b); break;
+        default: s = int32_t(-b); c = int32_t(a);  break;
+    }
+}
+
+} // namespace detail
+
+// Wide complex value for accumulated (unnormalised) DFT outputs
+struct Complex32 {
+    int32_t re;
+    int32_t im;
+    
+    constexpr bool operator==(const Complex32&) const = default;
+};
+
+// ============================================================
+// Numerically controlled oscillator
+// ============================================================
+
+// 32-bit phase accumulator driving the sine table
+// Phase: 2^32 per turn, frequency resolution sample_rate / 2^32
+// Output: ±16384 for ±1.0 (same as IntegerTrig::sin)
+template<typename TrigImpl = Trig>
+class Oscillator {
+public:
+    constexpr Oscillator() noexcept = default;
+
+    constexpr explicit Oscillator(uint32_t increment, uint32_t phase = 0) noexcept
+        : phase_(phase), increment_(increment) {}
+
+    // Phase increment for a tone of frequency_hz at sample_rate_hz.
+    // Precondition: frequency_hz < sample_rate_hz (asserted), so the
+    // increment fits 32 bits; without asserts a broken one gives 0
+    [[nodiscard]] static constexpr uint32_t increment_for(uint32_t frequency_hz,
+                                                          uint32_t sample_rate_hz) noexcept {
+        assert(frequency_hz < sample_rate_hz);
+        if (frequency_hz >= sample_rate_hz) return 0;
+        return static_cast<uint32_t>((uint64_t(frequency_hz) << 32) / sample_rate_hz);
+    }
+
+    // Change frequency without a phase jump; the next sample continues
+    // from the current phase
+    constexpr void set_increment(uint32_t increment) noexcept { increment_ = increment; }
+    constexpr void set_phase(uint32_t phase) noexcept { phase_ = phase; }
+
+    [[nodiscard]] constexpr uint32_t increment() const noexcept { return increment_; }
+    [[nodiscard]] constexpr uint32_t phase() const noexcept { return phase_; }
+
+    // Single sample, then advance
+    [[nodiscard]] int16_t next() noexcept {
+        int16_t value = TrigImpl::sin(angle_of(phase_));
+        phase_ += increment_;
+        return value;
+    }
+
+    // Block of sine samples
+    void fill(std::span<int16_t> out) noexcept {
+        uint16_t angles[BLOCK];
+        for (std::size_t done = 0; done < out.size(); done += BLOCK) {
+            std::size_t n = std::min(BLOCK, out.size() - done);
+            advance_block(angles, n);
+            TrigImpl::sin_batch(std::span<const uint16_t>(angles, n), out.subspan(done, n));
+        }
+    }
+
+    // Block of quadrature samples: i = cos, q = sin
+    // Processes min(i.size(), q.size()) samples
+    void fill_iq(std::span<int16_t> i, std::span<int16_t> q) noexcept {
+        std::size_t count = std::min(i.size(), q.size());
+        uint16_t angles[BLOCK];
+        for (std::size_t done = 0; done < count; done += BLOCK) {
+            std::size_t n = std::min(BLOCK, count - done);
+            advance_block(angles, n);
+            TrigImpl::sincos_batch(std::span<const uint16_t>(angles, n),
+                                   q.subspan(done, n), i.subspan(done, n));
+        }
+    }
+
+private:
+    static constexpr std::size_t BLOCK = 256;
+
+    // Top 14 bits of the phase are the table angle
+    static constexpr uint16_t angle_of(uint32_t phase) noexcept {
+        return static_cast<uint16_t>(phase >> 18);
+    }
+
+    // Angles for the next n samples; plain loop, autovectorises
+    void advance_block(uint16_t* angles, std::size_t n) noexcept {
+        uint32_t phase = phase_;
+        uint32_t increment = increment_;
+        for (std::size_t k = 0; k < n; ++k) {
+            angles[k] = angle_of(phase + static_cast<uint32_t>(k) * increment);
+        }
+        phase_ = phase + static_cast<uint32_t>(n) * increment;
+    }
+
+    uint32_t phase_ = 0;
+    uint32_t increment_ = 0;
+};
+
+// ============================================================
+// Quadrature mixer
+// ============================================================
+
+// Multiplies a stream by e^(jθn), θ from an Oscillator phase accumulator:
+// a real input x gives I = x·cos θ, Q = x·sin θ, a complex one is rotated.
+// Each block continues the phase of the last, so a capture gives the same
+// output whatever chunk sizes it is fed in. A negative frequency shifts
+// down: increment_for(-carrier, rate) brings the carrier to 0 Hz.
+//
+// Q15 samples against the Q14 table: products are exact in 32 bits, round
+// to nearest and saturate (only a complex sample longer than 1.0 can
+// clip). With AVX2, 16 samples per step from the same products, bit-exact
+// with the scalar loop. Outputs may be the inputs.
+template<typename TrigImpl = Trig>
+class Mixer {
+public:
+    constexpr Mixer() noexcept = default;
+
+    constexpr explicit Mixer(uint32_t increment, uint32_t phase = 0) noexcept : nco_(increment, phase) {}
+
+    // Phase increment for a shift of frequency_hz, negative to shift down.
+    // Precondition: |frequency_hz| < sample_rate_hz (asserted), as for
+    // Oscillator::increment_for; without asserts a broken one gives 0
+    [[nodiscard]] static constexpr uint32_t increment_for(int32_t frequency_hz, uint32_t sample_rate_hz) noexcept {
+        int64_t magnitude = frequency_hz < 0 ? -int64_t(frequency_hz) : frequency_hz;
+        assert(magnitude < int64_t(sample_rate_hz));
+        if (magnitude >= int64_t(sample_rate_hz)) return 0;
+        return static_cast<uint32_t>((int64_t(frequency_hz) * (int64_t(1) << 32)) / int64_t(sample_rate_hz));
+    }
+
+    constexpr void set_increment(uint32_t increment) noexcept { nco_.set_increment(increment); }
+    constexpr void set_phase(uint32_t phase) noexcept { nco_.set_phase(phase); }
+
+    [[nodiscard]] constexpr uint32_t increment() const noexcept { return nco_.increment(); }
+    [[nodiscard]] constexpr uint32_t phase() const noexcept { return nco_.phase(); }
+
+    // Single samples, then advance
+    [[nodiscard]] ComplexQ15 mix(int16_t x) noexcept {
+        int16_t s, c;
+        next_sincos(s, c);
+        return {narrow(int32_t(x) * c), narrow(int32_t(x) * s)};
+    }
+
+    [[nodiscard]] ComplexQ15 mix(ComplexQ15 z) noexcept {
+        int16_t s, c;
+        next_sincos(s, c);
+        return {narrow(int32_t(z.re) * c - int32_t(z.im) * s), narrow(int32_t(z.re) * s + int32_t(z.im) * c)};
+    }
+
+    // Real samples to I and Q. Processes the shortest of the spans
+    void mix(std::span<const int16_t> in, std::span<int16_t> i_out, std::span<int16_t> q_out) noexcept {
+        std::size_t count = std::min({in.size(), i_out.size(), q_out.size()});
+        int16_t sin_a[BLOCK], cos_a[BLOCK];
+        for (std::size_t done = 0; done < count; done += BLOCK) {
+            std::size_t n = std::min(BLOCK, count - done);
+            nco_.fill_iq(std::span<int16_t>(cos_a, n), std::span<int16_t>(sin_a, n));
+            mix_real(in.data() + done, cos_a, sin_a, i_out.data() + done, q_out.data() + done, n);
+        }
+    }
+
+    // Complex samples as separate I and Q arrays
+    void mix(std::span<const int16_t> i_in, std::span<const int16_t> q_in,
+             std::span<int16_t> i_out, std::span<int16_t> q_out) noexcept {
+        std::size_t count = std::min({i_in.size(), q_in.size(), i_out.size(), q_out.size()});
+        int16_t sin_a[BLOCK], cos_a[BLOCK];
+        for (std::size_t done = 0; done < count; done += BLOCK) {
+            std::size_t n = std::min(BLOCK, count - done);
+            nco_.fill_iq(std::span<int16_t>(cos_a, n), std::span<int16_t>(sin_a, n));
+            mix_split(i_in.data() + done, q_in.data() + done, cos_a, sin_a,
+                      i_out.data() + done, q_out.data() + done, n);
+        }
+    }
+
+    // Interleaved complex samples
+    void mix(std::span<const ComplexQ15> in, std::span<ComplexQ15> out) noexcept {
+        std::size_t count = std::min(in.size(), out.size());
+        int16_t sin_a[BLOCK], cos_a[BLOCK];
+        for (std::size_t done = 0; done < count; done += BLOCK) {
+            std::size_t n = std::min(BLOCK, count - done);
+            nco_.fill_iq(std::span<int16_t>(cos_a, n), std::span<int16_t>(sin_a, n));
+            mix_interleaved(in.data() + done, cos_a, sin_a, out.data() + done, n);
+        }
+    }
+
+private:
+    static constexpr std::size_t BLOCK = 256;
+
+    // Q15 times Q14 back to Q15
+    static constexpr int16_t narrow(int32_t product) noexcept {
+        return static_cast<int16_t>(std::clamp((product + (1 << 13)) >> 14, -32768, 32767));
+    }
+
+    void next_sincos(int16_t& s, int16_t& c) noexcept {
+        uint32_t phase = nco_.phase();
+        TrigImpl::sincos(static_cast<uint16_t>(phase >> 18), s, c);
+        nco_.set_phase(phase + nco_.increment());
+    }
+
+    static void mix_real(const int16_t* x, const int16_t* c, const int16_t* s,
+                         int16_t* i_out, int16_t* q_out, std::size_t n) noexcept {
+        std::size_t k = 0;
+#if defined(__AVX2__)
+        for (; k + 16 <= n; k += 16) {
+            rotate_avx2(load_avx2(x + k), _mm256_setzero_si256(), load_avx2(c + k), load_avx2(s + k),
+                        i_out + k, q_out + k);
+        }
+#endif
+        for (; k < n; ++k) {
+            int16_t value = x[k];
+            i_out[k] = narrow(int32_t(value) * c[k]);
+            q_out[k] = narrow(int32_t(value) * s[k]);
+        }
+    }
+
+    static void mix_split(const int16_t* i_in, const int16_t* q_in, const int16_t* c, const int16_t* s,
+                          int16_t* i_out, int16_t* q_out, std::size_t n) noexcept {
+        std::size_t k = 0;
+#if defined(__AVX2__)
+        for (; k + 16 <= n; k += 16) {
+            rotate_avx2(load_avx2(i_in + k), load_avx2(q_in + k), load_avx2(c + k), load_avx2(s + k),
+                        i_out + k, q_out + k);
+        }
+#endif
+        for (; k < n; ++k) {
+            int32_t re = i_in[k], im = q_in[k];
+            i_out[k] = narrow(re * c[k] - im * s[k]);
+            q_out[k] = narrow(re * s[k] + im * c[k]);
+        }
+    }
+
+    static void mix_interleaved(const ComplexQ15* in, const int16_t* c, const int16_t* s,
+                                ComplexQ15* out, std::size_t n) noexcept {
+        std::size_t k = 0;
+#if defined(__AVX2__)
+        for (; k + 16 <= n; k += 16) {
+            rotate_interleaved_avx2(in + k, load_avx2(c + k), load_avx2(s + k), out + k);
+        }
+#endif
+        for (; k < n; ++k) {
+            int32_t re = in[k].re, im = in[k].im;
+            out[k] = {narrow(re * c[k] - im * s[k]), narrow(re * s[k] + im * c[k])};
+        }
+    }
+
+#if defined(__AVX2__)
+    static __m256i load_avx2(const int16_t* p) noexcept {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+
+    // (sum + 2^13) >> 14 on 32-bit lanes
+    static __m256i round_avx2(__m256i sum) noexcept {
+        return _mm256_srai_epi32(_mm256_add_epi32(sum, _mm256_set1_epi32(1 << 13)), 14);
+    }
+
+    // 16 samples, split I and Q. madd on (re, im) and (cos, -sin) pairs
+    // gives re·cos - im·sin exactly; unpack and pack both work within
+    // 128-bit lanes, so the packed results come back in sample order
+    static void rotate_avx2(__m256i re, __m256i im, __m256i c, __m256i s,
+                            int16_t* i_out, int16_t* q_out) noexcept {
+        __m256i minus_s = _mm256_sub_epi16(_mm256_setzero_si256(), s);
+        __m256i z_lo = _mm256_unpacklo_epi16(re, im), z_hi = _mm256_unpackhi_epi16(re, im);
+        __m256i i_lo = _mm256_madd_epi16(z_lo, _mm256_unpacklo_epi16(c, minus_s));
+        __m256i i_hi = _mm256_madd_epi16(z_hi, _mm256_unpackhi_epi16(c, minus_s));
+        __m256i q_lo = _mm256_madd_epi16(z_lo, _mm256_unpacklo_epi16(s, c));
+        __m256i q_hi = _mm256_madd_epi16(z_hi, _mm256_unpackhi_epi16(s, c));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(i_out),
+                            _mm256_packs_epi32(round_avx2(i_lo), round_avx2(i_hi)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(q_out),
+                            _mm256_packs_epi32(round_avx2(q_lo), round_avx2(q_hi)));
+    }
+
+    // 16 interleaved samples: the data is already in (re, im) pairs, so
+    // the twiddles are put in sample order before pairing them up
+    static void rotate_interleaved_avx2(const ComplexQ15* in, __m256i c, __m256i s, ComplexQ15* out) noexcept {
+        c = _mm256_permute4x64_epi64(c, 0xD8);
+        s = _mm256_permute4x64_epi64(s, 0xD8);
+        __m256i minus_s = _mm256_sub_epi16(_mm256_setzero_si256(), s);
+        const __m256i high = _mm256_set1_epi32(32767), low = _mm256_set1_epi32(-32768);
+        for (int half = 0; half < 2; ++half) {
+            __m256i z = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + 8 * half));
+            __m256i i_pairs = half ? _mm256_unpackhi_epi16(c, minus_s) : _mm256_unpacklo_epi16(c, minus_s);
+            __m256i q_pairs = half ? _mm256_unpackhi_epi16(s, c) : _mm256_unpacklo_epi16(s, c);
+            __m256i re = _mm256_max_epi32(_mm256_min_epi32(round_avx2(_mm256_madd_epi16(z, i_pairs)), high), low);
+            __m256i im = _mm256_max_epi32(_mm256_min_epi32(round_avx2(_mm256_madd_epi16(z, q_pairs)), high), low);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8 * half),
+                                _mm256_blend_epi16(re, _mm256_slli_epi32(im, 16), 0xAA));
+        }
+    }
+#endif
+
+    Oscillator<TrigImpl> nco_;
+};
+
+// ============================================================
+// Fixed-point FFT
+// ============================================================
+
+// In-place radix-2 decimation-in-time FFT on Q15 complex data with
+// block-floating-point scaling. Each stage looks at the largest component
+// written by the previous stage and shifts right just enough that the
+// butterflies (growth up to 1 + √2 per component) cannot overflow.
+// The returned exponent e gives the unnormalised DFT as data * 2^e.
+// Twiddles are generated at compile time from TrigImpl::sincos.
+template<std::size_t N, typename TrigImpl = Trig>
+requires (N >= 4 && N <= 16384 && (N & (N - 1)) == 0)
+class FFT {
+public:
+    static constexpr std::size_t size() noexcept { return N; }
+    
+    // X[k] = sum x[n] e^(-2πikn/N) = data[k] * 2^exponent
+    [[nodiscard]] static int forward(std::span<ComplexQ15, N> data) noexcept {
+        return transform(data.data(), N, 1, false);
+    }
+    
+    // x[n] = (1/N) sum X[k] e^(2πikn/N) = data[n] * 2^exponent
+    // (the 1/N is folded into the returned exponent)
+    [[nodiscard]] static int inverse(std::span<ComplexQ15, N> data) noexcept {
+        return transform(data.data(), N, 1, true) - LOG2_N;
+    }
+    
+    // Spectrum of N real samples from one N/2-point complex FFT
+    // out[k] for k = 0 .. N/2, X[k] = out[k] * 2^exponent
+    [[nodiscard]] static int forward_real(std::span<const int16_t, N> in,
+                                          std::span<ComplexQ15, N / 2 + 1> out) noexcept {
+        constexpr std::size_t half = N / 2;
+        ComplexQ15* z = out.data();
+        for (std::size_t n = 0; n < half; ++n) {
+            z[n] = {in[2 * n], in[2 * n + 1]};
+        }
+        int exponent = transform(z, half, 2, false);
+        
+        // Split Z into the even/odd spectra and recombine:
+        // X[k] = (Z[k] + Z*[h-k]) / 2 - j W^k (Z[k] - Z*[h-k]) / 2
+        // Like a butterfly, components can grow by up to 1 + √2 after the
+        // halving, so pick the extra shift the same way as a stage does
+        int shift = stage_shift(max_component(z, half)) + 1;
+        int32_t z0_re = z[0].re;
+        int32_t z0_im = z[0].im;
+        
+        for (std::size_t k = 1; k <= half / 2; ++k) {
+            std::size_t m = half - k;
+            int32_t a_re = z[k].re, a_im = z[k].im;
+            int32_t b_re = z[m].re, b_im = z[m].im;
+            
+            // k and m = h - k are produced together, so both inputs are
+            // read before either output is written
+            ComplexQ15 xk = split_bin(a_re, a_im, b_re, b_im, twiddles[k], shift);
+            ComplexQ15 xm = split_bin(b_re, b_im, a_re, a_im, twiddles[m], shift);
+            z[k] = xk;
+            z[m] = xm;
+        }
+        
+        z[0] = {round_shift(z0_re + z0_im, shift - 1), 0};
+        z[half] = {round_shift(z0_re - z0_im, shift - 1), 0};
+        return exponent + shift - 1;
+    }
+    
+    // Forward transform of consecutive N-point frames; one exponent per frame
+    // Processes min(frames.size() / N, exponents.size()) frames
+    static void forward_batch(std::span<ComplexQ15> frames, std::span<int> exponents) noexcept {
+        std::size_t count = std::min(frames.size() / N, exponents.size());
+        for (std::size_t f = 0; f < count; ++f) {
+            exponents[f] = transform(frames.data() + f * N, N, 1, false);
+        }
+    }
+    
+    static constexpr std::size_t table_memory() { return sizeof(twiddles); }
+
+private:
+    static constexpr int LOG2_N = __builtin_ctz(N);
+    
+    // Largest pre-stage component for which a stage with shift s cannot
+    // overflow: 32767 / (1 + √2) * 2^s
+    static constexpr int32_t GROWTH_LIMIT_0 = 13573;
+    static constexpr int32_t GROWTH_LIMIT_1 = 27146;
+    
+    // W^k = e^(-2πik/N) in Q15 for k < N/2, from the Q14 table output
+    static constexpr std::array<ComplexQ15, N / 2> generate_twiddles() {
+        std::array<ComplexQ15, N / 2> table{};
+        for (std::size_t k = 0; k < N / 2; ++k) {
+            int16_t s = 0, c = 0;
+            TrigImpl::sincos(static_cast<uint16_t>(k * (16384 / N)), s, c);
+            table[k] = {detail::q14_to_q15(c), detail::q14_to_q15(static_cast<int16_t>(-s))};
+        }
+        return table;
+    }
+    
+    alignas(64) static constexpr auto twiddles = generate_twiddles();
+    
+    static constexpr int16_t round_shift(int32_t v, int shift) noexcept {
+        return static_cast<int16_t>(shift > 0 ? (v + (1 << (shift - 1))) >> shift : v);
+    }
+    
+    static int32_t max_component(const ComplexQ15* data, std::size_t n) noexcept {
+        int32_t max_abs = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            int32_t re = data[i].re < 0 ? -int32_t(data[i].re) : data[i].re;
+            int32_t im = data[i].im < 0 ? -int32_t(data[i].im) : data[i].im;
+            max_abs = std::max({max_abs, re, im});
+        }
+        return max_abs;
+    }
+    
+    static constexpr int stage_shift(int32_t max_abs) noexcept {
+        return (max_abs < GROWTH_LIMIT_0) ? 0 : (max_abs < GROWTH_LIMIT_1) ? 1 : 2;
+    }
+    
+    // One output bin of the real-FFT split step
+    static ComplexQ15 split_bin(int32_t a_re, int32_t a_im, int32_t b_re, int32_t b_im,
+                                ComplexQ15 w, int shift) noexcept {
+        // Even part: a + conj(b); odd part: a - conj(b)
+        int32_t e_re = a_re + b_re;
+        int32_t e_im = a_im - b_im;
+        int32_t o_re = a_re - b_re;
+        int32_t o_im = a_im + b_im;
+        
+        // -j * W * odd
+        int32_t t_re = (o_re * w.re - o_im * w.im + (1 << 14)) >> 15;
+        int32_t t_im = (o_re * w.im + o_im * w.re + (1 << 14)) >> 15;
+        
+        return {round_shift(e_re + t_im, shift), round_shift(e_im - t_re, shift)};
+    }
+    
+    // Core in-place transform of n points using every stride-th twiddle
+    static int transform(ComplexQ15* data, std::size_t n, std::size_t stride, bool inverse) noexcept {
+        // Bit-reversal permutation
+        for (std::size_t i = 1, j = 0; i < n; ++i) {
+            std::size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1) {
+                j ^= bit;
+            }
+            j ^= bit;
+            if (i < j) {
+                std::swap(data[i], data[j]);
+            }
+        }
+        
+        int exponent = 0;
+        int32_t max_abs = max_component(data, n);
+        
+        for (std::size_t len = 2; len <= n; len <<= 1) {
+            int shift = stage_shift(max_abs);
+            int32_t rounding = (1 << shift) >> 1;
+            exponent += shift;
+            max_abs = 0;
+            
+            std::size_t half = len >> 1;
+            std::size_t step = (n / len) * stride;
+            
+            for (std::size_t base = 0; base < n; base += len) {
+                for (std::size_t j = 0; j < half; ++j) {
+                    ComplexQ15 w = twiddles[j * step];
+                    int32_t w_im = inverse ? -int32_t(w.im) : w.im;
+                    
+                    ComplexQ15& a = data[base + j];
+                    ComplexQ15& b = data[base + j + half];
+                    
+                    int32_t t_re = (b.re * int32_t(w.re) - b.im * w_im + (1 << 14)) >> 15;
+                    int32_t t_im = (b.re * w_im + b.im * int32_t(w.re) + (1 << 14)) >> 15;
+                    
+                    int32_t a_re = (a.re + t_re + rounding) >> shift;
+                    int32_t a_im = (a.im + t_im + rounding) >> shift;
+                    int32_t b_re = (a.re - t_re + rounding) >> shift;
+                    int32_t b_im = (a.im - t_im + rounding) >> shift;
+                    
+                    a = {static_cast<int16_t>(a_re), static_cast<int16_t>(a_im)};
+                    b = {static_cast<int16_t>(b_re), static_cast<int16_t>(b_im)};
+                    
+                    max_abs = std::max({max_abs, a_re < 0 ? -a_re : a_re, a_im < 0 ? -a_im : a_im,
+                                        b_re < 0 ? -b_re : b_re, b_im < 0 ? -b_im : b_im});
+                }
+            }
+        }
+        return exponent;
+    }
+};
+
+// ============================================================
+// Single-bin detectors
+// ============================================================
+
+// Goertzel filter bank: Bins tones evaluated over blocks of samples
+// Each bin is a phase step in table units per sample (16384 per turn),
+// so the frequency resolution is sample_rate / 16384. Coefficients are Q30
+// from the series the tables are built from: with Q14 table values a
+// 50 Hz bin at 8 kHz would resonate about 2% off frequency.
+// State is stored per bin in parallel arrays (SoA); update() costs one
+// multiply per bin per sample. An on-bin tone of amplitude A grows the
+// state by about A / (2 sin w) per sample, so size blocks to stay in int32.
+template<typename TrigImpl = Trig, std::size_t Bins = 1>
+requires (Bins >= 1)
+class Goertzel {
+public:
+    constexpr explicit Goertzel(const std::array<uint16_t, Bins>& steps) noexcept {
+        for (std::size_t b = 0; b < Bins; ++b) {
+            detail::sincos_q30(steps[b], sin_[b], cos_[b]);
+        }
+    }
+    
+    // Table phase step for frequency_hz at sample_rate_hz, rounded.
+    // Precondition: frequency_hz < sample_rate_hz (asserted), as for
+    // Oscillator::increment_for; without asserts a broken one gives 0
+    [[nodiscard]] static constexpr uint16_t step_for(uint32_t frequency_hz,
+                                                     uint32_t sample_rate_hz) noexcept {
+        assert(frequency_hz < sample_rate_hz);
+        if (frequency_hz >= sample_rate_hz) return 0;
+        return static_cast<uint16_t>(((uint64_t(frequency_hz) << 14) + sample_rate_hz / 2) / sample_rate_hz);
+    }
+    
+    // s[n] = x[n] + 2cos(w) s[n-1] - s[n-2] for every bin
+    void update(int16_t x) noexcept {
+        for (std::size_t b = 0; b < Bins; ++b) {
+            int32_t s0 = x + static_cast<int32_t>((int64_t(cos_[b]) * s1_[b]) >> 29) - s2_[b];
+            s2_[b] = s1_[b];
+            s1_[b] = s0;
+        }
+    }
+    
+    void update(std::span<const int16_t> block) noexcept {
+        for (int16_t x : block) {
+            update(x);
+        }
+    }
+    
+    // DFT value of bin b over the samples since reset()
+    // Magnitude equals |sum x[n] e^(-iwn)|; phase is referenced to the last sample
+    [[nodiscard]] Complex32 result(std::size_t b) const noexcept {
+        int32_t re = s1_[b] - static_cast<int32_t>((int64_t(cos_[b]) * s2_[b]) >> 30);
+        int32_t im = static_cast<int32_t>((int64_t(sin_[b]) * s2_[b]) >> 30);
+        return {re, im};
+    }
+    
+    [[nodiscard]] int32_t magnitude(std::size_t b) const noexcept {
+        Complex32 r = result(b);
+        return TrigImpl::magnitude(r.re, r.im);
+    }
+    
+    // Start a new block
+    constexpr void reset() noexcept {
+        s1_.fill(0);
+        s2_.fill(0);
+    }
+    
+    static constexpr std::size_t bins() noexcept { return Bins; }
+
+private:
+    // cos/sin of each step, Q30; the recurrence uses 2cos as cos >> 29
+    std::array<int32_t, Bins> cos_{};
+    std::array<int32_t, Bins> sin_{};
+    std::array<int32_t, Bins> s1_{};
+    std::array<int32_t, Bins> s2_{};
+};
+
+// Sliding DFT over the last N samples for Bins integer bin indices k < N
+// Each sample adds (x_new - x_old) e^(-2πikn/N) with the twiddle index
+// taken modulo N, so the sample leaving the window is removed with exactly
+// the product it was added with. The 64-bit accumulators never drift,
+// unlike the recursive X = (X + x_new - x_old) e^(2πik/N) form.
+template<std::size_t N, typename TrigImpl = Trig, std::size_t Bins = 1>
+requires (N >= 2 && N <= 16384 && Bins >= 1)
+class SlidingDFT {
+public:
+    constexpr explicit SlidingDFT(const std::array<uint16_t, Bins>& bins) noexcept : k_(bins) {
+        for (std::size_t b = 0; b < Bins; ++b) {
+            k_[b] = static_cast<uint16_t>(k_[b] % N);
+        }
+    }
+    
+    // Push one sample, drop the oldest; O(Bins)
+    void update(int16_t x) noexcept {
+        int32_t delta = int32_t(x) - history_[pos_];
+        history_[pos_] = x;
+        pos_ = (pos_ + 1 == N) ? 0 : pos_ + 1;
+        
+        for (std::size_t b = 0; b < Bins; ++b) {
+            ComplexQ15 w = twiddles[index_[b]];
+            re_[b] += int64_t(delta) * w.re;
+            im_[b] += int64_t(delta) * w.im;
+            uint32_t next = index_[b] + k_[b];
+            index_[b] = static_cast<uint16_t>(next >= N ? next - N : next);
+        }
+    }
+    
+    void update(std::span<const int16_t> block) noexcept {
+        for (int16_t x : block) {
+            update(x);
+        }
+    }
+    
+    // DFT of the current window, X[k] = sum x[m] e^(-2πikm/N), m = 0 oldest
+    [[nodiscard]] Complex32 result(std::size_t b) const noexcept {
+        // Accumulators are referenced to absolute sample 0; rotate by the
+        // position of the oldest sample. index_ already points at it.
+        ComplexQ15 w = twiddles[index_[b]];
+        int64_t re = re_[b] >> 15;
+        int64_t im = im_[b] >> 15;
+        // multiply by conj(w)
+        return {static_cast<int32_t>((re * w.re + im * w.im) >> 15),
+                static_cast<int32_t>((im * w.re - re * w.im) >> 15)};
+    }
+    
+    // |X[k]| without the phase rotation
+    [[nodiscard]] int32_t magnitude(std::size_t b) const noexcept {
+        return TrigImpl::magnitude(static_cast<int32_t>(re_[b] >> 15),
+                                   static_cast<int32_t>(im_[b] >> 15));
+    }
+    
+    constexpr void reset() noexcept {
+        history_.fill(0);
+        re_.fill(0);
+        im_.fill(0);
+        index_.fill(0);
+        pos_ = 0;
+    }
+    
+    static constexpr std::size_t window() noexcept { return N; }
+    static constexpr std::size_t table_memory() { return sizeof(twiddles); }
+
+private:
+    // e^(-2πim/N) in Q15, m < N, from the sine table
+    static constexpr std::array<ComplexQ15, N> generate_twiddles() {
+        std::array<ComplexQ15, N> table{};
+        for (std::size_t m = 0; m < N; ++m) {
+            int16_t s = 0, c = 0;
+            TrigImpl::sincos(static_cast<uint16_t>((m * 16384 + N / 2) / N), s, c);
+            table[m] = {detail::q14_to_q15(c), detail::q14_to_q15(static_cast<int16_t>(-s))};
+        }
+        return table;
+    }
+    
+    static constexpr auto twiddles = generate_twiddles();
+    
+    std::array<int16_t, N> history_{};
+    std::array<int64_t, Bins> re_{};
+    std::array<int64_t, Bins> im_{};
+    std::array<uint16_t, Bins> k_{};
+    std::array<uint16_t, Bins> index_{};
+    std::size_t pos_ = 0;
+};
+
+} // namespace FastTrig
+
+#endif // FAST_TRIG_DSP_HPP
@@ -0,0 +1,228 @@
+// fast_trig_fixed.hpp - Fixed-point number type for FastTrig results
+// Version: 1.0.0
+// License: MIT
+//
+// Fixed<IntBits, FracBits, Storage> is a signed two's complement number
+// with IntBits integer and FracBits fraction bits (plus the sign). It has
+// no runtime overhead: every operation is the integer multiply, add or
+// shift you would write by hand, and the generated code is identical (see
+// `make asm-diff`). The type catches the format mistakes those hand-written
+// shifts allow:
+//   - products are widened exactly, and a product needing more than 64 bits
+//     does not compile;
+//   - implicit conversions only exist where no bit is lost; narrowing goes
+//     through fixed_cast (wraps) or saturate_cast (clamps);
+//   - constants from floating-point literals are checked for range at
+//     compile time.
+
+#ifndef FAST_TRIG_FIXED_HPP
+#define FAST_TRIG_FIXED_HPP
+
+#include <cstdint>
+#include <compare>
+#include <concepts>
+#include <type_traits>
+
+namespace FastTrig {
+
+// ============================================================
+// Rounding policies for dropping fraction bits
+// ============================================================
+
+// Arithmetic shift right, toward -∞ (default; the same as `>> n`)
+struct RoundFloor {};
+
+// To the nearest value, ties toward +∞ (the same as `(x + half) >> n`).
+// fixed_cast and to_int need half an LSB of headroom below the storage
+// maximum, where the add would overflow; saturate_cast clamps instead
+struct RoundNearest {};
+
+// Toward zero (the same as `/ (1 << n)` on a signed integer)
+struct RoundToZero {};
+
+template<typename R>
+concept RoundingPolicy = std::same_as<R, RoundFloor> || std::same_as<R, RoundNearest> ||
+                         std::same_as<R, RoundToZero>;
+
+namespace detail {
+
+// Smallest signed integer holding Bits bits including the sign
+template<int Bits>
+using fixed_storage_t =
+    std::conditional_t<(Bits <= 8), int8_t,
+    std::conditional_t<(Bits <= 16), int16_t,
+    std::conditional_t<(Bits <= 32), int32_t,
+    std::conditional_t<(Bits <= 64), int64_t, void>>>>;
+
+// raw / 2^Shift with the given rounding, Shift > 0
+template<RoundingPolicy Rounding, int Shift, std::signed_integral T>
+constexpr T shift_round(T raw) noexcept {
+    if constexpr (std::same_as<Rounding, RoundNearest>) {
+        return static_cast<T>((raw + (T(1) << (Shift - 1))) >> Shift);
+    } else if constexpr (std::same_as<Rounding, RoundToZero>) {
+        return static_cast<T>(raw / (T(1) << Shift));
+    } else {
+        return static_cast<T>(raw >> Shift);
+    }
+}
+
+} // namespace detail
+
+template<int IntBits, int FracBits,
+         std::signed_integral Storage = detail::fixed_storage_t<1 + IntBits + FracBits>>
+requires (IntBits >= 0 && FracBits >= 0 && 1 + IntBits + FracBits <= int(sizeof(Storage)) * 8)
+class Fixed {
+public:
+    using storage_type = Storage;
+    static constexpr int INT_BITS = IntBits;
+    static constexpr int FRAC_BITS = FracBits;
+
+    // Largest and smallest raw values the format allows
+    static constexpr Storage RAW_MAX = static_cast<Storage>((uint64_t(1) << (IntBits + FracBits)) - 1);
+    static constexpr Storage RAW_MIN = static_cast<Storage>(-RAW_MAX - 1);
+
+    constexpr Fixed() noexcept = default;
+
+    // Integer value; the caller keeps it within IntBits
+    template<std::integral I>
+    explicit constexpr Fixed(I value) noexcept
+        : raw_(static_cast<Storage>(static_cast<Storage>(value) * (Storage(1) << FracBits))) {}
+
+    // Constant from a literal, rounded to nearest; out of range does not
+    // compile
+    consteval Fixed(double value) : raw_(0) {
+        double scaled = value * double(uint64_t(1) << FracBits);
+        scaled += (scaled < 0) ? -0.5 : 0.5;
+        if (scaled > double(RAW_MAX) + 0.5 || scaled < double(RAW_MIN) - 0.5) {
+            throw "Fixed: constant out of range";
+        }
+        raw_ = static_cast<Storage>(scaled);
+    }
+
+    // Lossless conversion from a format with no more integer or fraction bits
+    template<int I, int F, typename S>
+    requires (I <= IntBits && F <= FracBits)
+    constexpr Fixed(Fixed<I, F, S> other) noexcept
+        : raw_(static_cast<Storage>(static_cast<Storage>(other.raw()) * (Storage(1) << (FracBits - F)))) {}
+
+    [[nodiscard]] static constexpr Fixed from_raw(Storage raw) noexcept {
+        Fixed result;
+        result.raw_ = raw;
+        return result;
+    }
+
+    [[nodiscard]] constexpr Storage raw() const noexcept { return raw_; }
+
+    // Integer part with the given rounding
+    template<RoundingPolicy Rounding = RoundFloor>
+    [[nodiscard]] constexpr Storage to_int() const noexcept {
+        if constexpr (FracBits == 0) {
+            return raw_;
+        } else {
+            return detail::shift_round<Rounding, FracBits>(raw_);
+        }
+    }
+
+    // Same-format arithmetic wraps like the storage integer. Widen first
+    // (multiply, or convert to a wider Fixed) or use add_sat/sub_sat when
+    // the sum can leave the format.
+    friend constexpr Fixed operator+(Fixed a, Fixed b) noexcept {
+        return from_raw(static_cast<Storage>(a.raw_ + b.raw_));
+    }
+
+    friend constexpr Fixed operator-(Fixed a, Fixed b) noexcept {
+        return from_raw(static_cast<Storage>(a.raw_ - b.raw_));
+    }
+
+    friend constexpr Fixed operator-(Fixed a) noexcept {
+        return from_raw(static_cast<Storage>(-a.raw_));
+    }
+
+    constexpr Fixed& operator+=(Fixed other) noexcept { return *this = *this + other; }
+    constexpr Fixed& operator-=(Fixed other) noexcept { return *this = *this - other; }
+
+    friend constexpr bool operator==(Fixed a, Fixed b) noexcept = default;
+    friend constexpr auto operator<=>(Fixed a, Fixed b) noexcept = default;
+
+private:
+    Storage raw_;
+};
+
+// Widening multiply: exact, Q(I1 + I2 + 1).(F1 + F2). The extra integer bit
+// holds (-2^I1) · (-2^I2).
+template<int I1, int F1, typename S1, int I2, int F2, typename S2>
+[[nodiscard]] constexpr auto operator*(Fixed<I1, F1, S1> a, Fixed<I2, F2, S2> b) noexcept {
+    static_assert(2 + I1 + I2 + F1 + F2 <= 64, "Fixed: product needs more than 64 bits");
+    using Result = Fixed<I1 + I2 + 1, F1 + F2>;
+    using Wide = typename Result::storage_type;
+    return Result::from_raw(static_cast<Wide>(Wide(a.raw()) * Wide(b.raw())));
+}
+
+// Change format explicitly. Fraction bits are dropped with Rounding; lost
+// integer bits wrap, like static_cast on the storage integer.
+template<typename To, RoundingPolicy Rounding = RoundFloor, int I, int F, typename S>
+[[nodiscard]] constexpr To fixed_cast(Fixed<I, F, S> from) noexcept {
+    using ToStorage = typename To::storage_type;
+    using Wide = std::conditional_t<(sizeof(S) > sizeof(ToStorage)), S, ToStorage>;
+    constexpr int shift = F - To::FRAC_BITS;
+
+    Wide raw = from.raw();
+    if constexpr (shift > 0) {
+        raw = detail::shift_round<Rounding, shift>(raw);
+    } else if constexpr (shift < 0) {
+        raw = static_cast<Wide>(raw * (Wide(1) << -shift));
+    }
+    return To::from_raw(static_cast<ToStorage>(raw));
+}
+
+// As fixed_cast, but values outside To clamp to its limits
+template<typename To, RoundingPolicy Rounding = RoundFloor, int I, int F, typename S>
+[[nodiscard]] constexpr To saturate_cast(Fixed<I, F, S> from) noexcept {
+    constexpr int shift = F - To::FRAC_BITS;
+
+    if constexpr (shift >= 0) {
+        // Clamp after rounding, in 64 bits: the round-to-nearest carry can
+        // take the largest values one past To::RAW_MAX even with equal
+        // integer bits. A 64-bit source gets the carry after the shift,
+        // where it cannot overflow
+        int64_t raw = from.raw();
+        if constexpr (shift > 0 && std::same_as<Rounding, RoundNearest> && sizeof(S) == 8) {
+            raw = (raw >> shift) + ((raw >> (shift - 1)) & 1);
+        } else if constexpr (shift > 0) {
+            raw = detail::shift_round<Rounding, shift>(raw);
+        }
+        if constexpr (shift > 0 || I > To::INT_BITS) {
+            if (raw > int64_t(To::RAW_MAX)) return To::from_raw(To::RAW_MAX);
+            if (raw < int64_t(To::RAW_MIN)) return To::from_raw(To::RAW_MIN);
+        }
+        return To::from_raw(static_cast<typename To::storage_type>(raw));
+    } else {
+        // Clamp before scaling up, against the limits shifted down
+        constexpr int64_t max = int64_t(To::RAW_MAX) >> -shift;
+        constexpr int64_t min = int64_t(To::RAW_MIN) >> -shift;
+        int64_t raw = from.raw();
+        if (raw > max) return To::from_raw(To::RAW_MAX);
+        if (raw < min) return To::from_raw(To::RAW_MIN);
+        return fixed_cast<To>(from);
+    }
+}
+
+// Saturating same-format add and subtract
+template<int I, int F, typename S>
+[[nodiscard]] constexpr Fixed<I, F, S> add_sat(Fixed<I, F, S> a, Fixed<I, F, S> b) noexcept {
+    return saturate_cast<Fixed<I, F, S>>(Fixed<I + 1, F>(a) + Fixed<I + 1, F>(b));
+}
+
+template<int I, int F, typename S>
+[[nodiscard]] constexpr Fixed<I, F, S> sub_sat(Fixed<I, F, S> a, Fixed<I, F, S> b) noexcept {
+    return saturate_cast<Fixed<I, F, S>>(Fixed<I + 1, F>(a) - Fixed<I + 1, F>(b));
+}
+
+// Formats of the library's outputs
+using Q14 = Fixed<1, 14, int16_t>;   // IntegerTrig/PolyTrig sin and cos, ±1.0 = ±16384
+using Q15 = Fixed<0, 15, int16_t>;   // ComplexQ15 samples and twiddles
+using Q31 = Fixed<0, 31, int32_t>;   // IntegerTrig32 sin and cos
+
+} // namespace FastTrig
+
+#endif // FAST_TRIG_FIXED_HPP
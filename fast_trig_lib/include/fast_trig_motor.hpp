@@ -0,0 +1,282 @@
+// fast_trig_motor.hpp - Motor control stages on top of FastTrig
+// Version: 1.0.0
+// License: MIT
+//
+// Field-oriented control and rotor angle tracking in integer arithmetic,
+// for current loops on small cores. Currents and voltages are int16 in the
+// application's units, rotor angles are Angle14 (16384 per turn).
+
+#ifndef FAST_TRIG_MOTOR_HPP
+#define FAST_TRIG_MOTOR_HPP
+
+#include "fast_trig.hpp"
+#include <cassert>
+
+namespace FastTrig {
+
+// Two measured phase currents; phase c is -(a + b)
+struct PhaseCurrents {
+    int16_t a;
+    int16_t b;
+};
+
+// Stationary frame, amplitude-invariant Clarke
+struct AlphaBeta {
+    int16_t alpha;
+    int16_t beta;
+
+    constexpr bool operator==(const AlphaBeta&) const = default;
+};
+
+// Rotor frame
+struct DQ {
+    int16_t d;
+    int16_t q;
+
+    constexpr bool operator==(const DQ&) const = default;
+};
+
+// Timer compare values for the three half bridges, 0..period
+struct PwmDuty {
+    uint16_t a;
+    uint16_t b;
+    uint16_t c;
+
+    constexpr bool operator==(const PwmDuty&) const = default;
+};
+
+// ============================================================
+// Field-oriented control
+// ============================================================
+
+// One FOC current-loop step: Clarke and Park on the measured currents,
+// inverse Park and space-vector PWM on the voltage command, all from one
+// sincos of the rotor angle.
+//
+// Voltages are scaled so that 32768 is Vdc/√3, the largest vector the
+// inverter makes with sinusoidal phase voltages. SVPWM is min-max
+// injection: a voltage vector up to 32767 long stays linear, a longer one
+// clips the duties at 0 and the period. Products are exact in 32 bits;
+// results round to nearest and saturate to int16.
+template<typename TrigImpl = Trig>
+class FOC {
+public:
+    struct Cycle {
+        DQ current;
+        PwmDuty duty;
+    };
+
+    constexpr explicit FOC(uint16_t pwm_period) noexcept : period_(pwm_period) {}
+
+    [[nodiscard]] constexpr uint16_t period() const noexcept { return period_; }
+
+    // α = a, β = (a + 2b)/√3
+    [[nodiscard]] static constexpr AlphaBeta clarke(PhaseCurrents i) noexcept {
+        Value a(i.a), b(i.b);
+        return {i.a, narrow(a * INV_SQRT3 + b * TWO_INV_SQRT3)};
+    }
+
+    // Stationary to rotor frame; sin and cos of the rotor angle
+    [[nodiscard]] static constexpr DQ park(AlphaBeta v, Q14 sin_theta, Q14 cos_theta) noexcept {
+        Value alpha(v.alpha), beta(v.beta);
+        return {narrow(alpha * cos_theta + beta * sin_theta), narrow(beta * cos_theta - alpha * sin_theta)};
+    }
+
+    [[nodiscard]] static constexpr AlphaBeta inverse_park(DQ v, Q14 sin_theta, Q14 cos_theta) noexcept {
+        Value d(v.d), q(v.q);
+        return {narrow(d * cos_theta - q * sin_theta), narrow(d * sin_theta + q * cos_theta)};
+    }
+
+    // Phase voltages over √3 from the inverse Clarke, shifted by the
+    // midpoint of the largest and smallest so the vector is centred in
+    // the DC bus; duty = 1/2 + phase/32768
+    [[nodiscard]] constexpr PwmDuty svpwm(AlphaBeta v) const noexcept {
+        Value alpha(v.alpha), beta(v.beta);
+        int32_t a = (alpha * INV_SQRT3).raw();
+        int32_t b = (beta * HALF - alpha * HALF_INV_SQRT3).raw();
+        int32_t c = -b - a;
+        int32_t mid = (std::max({a, b, c}) + std::min({a, b, c})) >> 1;
+        return {duty(a - mid), duty(b - mid), duty(c - mid)};
+    }
+
+    // Measured currents in the rotor frame and duties for the voltage
+    // command, one sincos for both
+    [[nodiscard]] Cycle run(PhaseCurrents i, Angle14 theta, DQ voltage) const noexcept {
+        Q14 s, c;
+        TrigImpl::sincos(theta, s, c);
+        return {park(clarke(i), s, c), svpwm(inverse_park(voltage, s, c))};
+    }
+
+    // As above, with the current controllers in the middle:
+    // controller(DQ current) returns the DQ voltage to apply this cycle
+    template<typename Controller>
+    requires std::is_invocable_r_v<DQ, Controller&, DQ>
+    [[nodiscard]] Cycle run(PhaseCurrents i, Angle14 theta, Controller&& controller) const {
+        Q14 s, c;
+        TrigImpl::sincos(theta, s, c);
+        DQ current = park(clarke(i), s, c);
+        return {current, svpwm(inverse_park(controller(current), s, c))};
+    }
+
+    // Offline simulation: one cycle per sample through
+    // TrigImpl::sincos_batch, bit-exact with run(). Processes the shortest
+    // of the spans
+    void run(std::span<const PhaseCurrents> currents, std::span<const Angle14> angles,
+             std::span<const DQ> voltages, std::span<Cycle> out) const noexcept {
+        std::size_t count = std::min({currents.size(), angles.size(), voltages.size(), out.size()});
+        uint16_t raw[BLOCK];
+        int16_t sin_a[BLOCK], cos_a[BLOCK];
+        for (std::size_t start = 0; start < count; start += BLOCK) {
+            std::size_t n = std::min(BLOCK, count - start);
+            for (std::size_t k = 0; k < n; ++k) {
+                raw[k] = angles[start + k].raw();
+            }
+            TrigImpl::sincos_batch(std::span<const uint16_t>(raw, n), std::span<int16_t>(sin_a, n),
+                                   std::span<int16_t>(cos_a, n));
+            for (std::size_t k = 0; k < n; ++k) {
+                Q14 s = Q14::from_raw(sin_a[k]), c = Q14::from_raw(cos_a[k]);
+                out[start + k] = {park(clarke(currents[start + k]), s, c),
+                                  svpwm(inverse_park(voltages[start + k], s, c))};
+            }
+        }
+    }
+
+private:
+    static constexpr std::size_t BLOCK = 256;
+
+    // int16 inputs as Q15.0; times Q14 is an exact Q17.14 in 32 bits
+    using Value = Fixed<15, 0, int16_t>;
+    using Wide = Fixed<17, 14>;
+
+    static constexpr Q14 INV_SQRT3 = 0.57735026918962576;
+    static constexpr Q14 TWO_INV_SQRT3 = 1.1547005383792515;
+    static constexpr Q14 HALF_INV_SQRT3 = 0.28867513459481288;
+    static constexpr Q14 HALF = 0.5;
+
+    static constexpr int16_t narrow(Wide value) noexcept {
+        return saturate_cast<Value, RoundNearest>(value).raw();
+    }
+
+    // Q14 phase in units of 1/32768 duty, clipped to [0, 1] of the period
+    constexpr uint16_t duty(int32_t phase_q14) const noexcept {
+        int32_t duty_q15 = (phase_q14 + (16384 << 14) + (1 << 13)) >> 14;
+        duty_q15 = std::clamp(duty_q15, 0, 32768);
+        return static_cast<uint16_t>((uint32_t(duty_q15) * period_ + (1u << 14)) >> 15);
+    }
+
+    uint16_t period_;
+};
+
+// ============================================================
+// Angle tracking observer
+// ============================================================
+
+// Type-II phase-locked loop for resolver or sin/cos encoder samples. Each
+// sample costs one sincos of the estimate and a few multiply-accumulates:
+//   θ̂       += ω̂
+//   error    = sin_in·cos(θ̂) - cos_in·sin(θ̂)     ~ A·sin(θ - θ̂)
+//   ω̂       += ki·error
+//   θ̂       += kp·error
+// instead of an atan2 per sample and a difference for speed. The estimate
+// is a 64-bit phase (2^64 per turn) so slow speeds keep their resolution.
+//
+// Gains are critically damped for the requested bandwidth, assuming the
+// sin/cos amplitude given at construction; a smaller amplitude lowers the
+// bandwidth in proportion. A zero amplitude is taken as 1.
+//
+// Precondition: sample_rate_hz > 0 and bandwidth_hz <= sample_rate_hz / 10
+// (asserted). Without asserts, a constructor that breaks it leaves both
+// gains at zero and the observer coasts.
+template<typename TrigImpl = Trig>
+class TrackingObserver {
+public:
+    // ωn = 2π·bandwidth/fs per sample; kp = 2ωn and ki = ωn² in radians,
+    // converted to phase units per unit of error: the 2π of kp cancels.
+    // With bandwidth <= fs/10 the ki product stays below 2^63
+    TrackingObserver(uint32_t bandwidth_hz, uint32_t sample_rate_hz, int16_t amplitude) noexcept {
+        assert(sample_rate_hz > 0 && uint64_t(bandwidth_hz) * 10 <= sample_rate_hz);
+        if (sample_rate_hz == 0 || uint64_t(bandwidth_hz) * 10 > sample_rate_hz) return;
+        
+        uint64_t unit = (uint64_t(1) << 50) / sample_rate_hz;   // 2^50 / fs
+        uint64_t per_amplitude = std::max<uint64_t>(amplitude < 0 ? -int32_t(amplitude) : amplitude, 1);
+        kp_ = static_cast<int64_t>(unit * 2 * bandwidth_hz / per_amplitude);
+        ki_ = static_cast<int64_t>(((unit * bandwidth_hz / sample_rate_hz) * bandwidth_hz * TWO_PI_Q16 >> 16) /
+                                   per_amplitude);
+    }
+
+    // Jump to the angle of one sample with zero speed, so the loop does
+    // not have to pull in from far away
+    void acquire(int16_t sin_in, int16_t cos_in) noexcept {
+        phase_ = uint64_t(TrigImpl::atan2(sin_in, cos_in)) << 50;
+        velocity_ = 0;
+    }
+
+    void reset(Angle32 angle = {}, int32_t velocity = 0) noexcept {
+        phase_ = uint64_t(angle.raw()) << 32;
+        velocity_ = int64_t(velocity) * (int64_t(1) << 32);
+    }
+
+    // One sample: predict with the current speed, then correct. Returns
+    // the angle of this sample, with no lag at constant speed
+    Angle14 update(int16_t sin_in, int16_t cos_in) noexcept {
+        phase_ += static_cast<uint64_t>(velocity_);
+        Q14 s, c;
+        TrigImpl::sincos(angle(), s, c);
+        int64_t error = int32_t(sin_in) * c.raw() - int32_t(cos_in) * s.raw();
+        velocity_ += error * ki_;
+        phase_ += static_cast<uint64_t>(error * kp_);
+        return angle();
+    }
+
+    // Block of samples; the loop is sequential, so this saves only the
+    // call overhead. Processes the shortest of the spans
+    void update(std::span<const int16_t> sin_in, std::span<const int16_t> cos_in,
+                std::span<Angle14> angles) noexcept {
+        std::size_t count = std::min({sin_in.size(), cos_in.size(), angles.size()});
+        for (std::size_t i = 0; i < count; ++i) {
+            angles[i] = update(sin_in[i], cos_in[i]);
+        }
+    }
+
+    // As above, also recording velocity()
+    void update(std::span<const int16_t> sin_in, std::span<const int16_t> cos_in,
+                std::span<Angle14> angles, std::span<int32_t> velocities) noexcept {
+        std::size_t count = std::min({sin_in.size(), cos_in.size(), angles.size(), velocities.size()});
+        for (std::size_t i = 0; i < count; ++i) {
+            angles[i] = update(sin_in[i], cos_in[i]);
+            velocities[i] = velocity();
+        }
+    }
+
+    // Rounded to the nearest unit
+    [[nodiscard]] Angle14 angle() const noexcept {
+        return Angle14::from_raw(static_cast<uint32_t>((phase_ + (uint64_t(1) << 49)) >> 50));
+    }
+
+    [[nodiscard]] Angle32 angle32() const noexcept {
+        return Angle32::from_raw(static_cast<uint32_t>((phase_ + (uint64_t(1) << 31)) >> 32));
+    }
+
+    // Angle32 units per sample
+    [[nodiscard]] int32_t velocity() const noexcept {
+        return static_cast<int32_t>(velocity_ >> 32);
+    }
+
+    // Revolutions per minute of the sin/cos signal (electrical for a
+    // multi-pole resolver)
+    [[nodiscard]] int32_t velocity_rpm(uint32_t sample_rate_hz) const noexcept {
+        return static_cast<int32_t>((int64_t(velocity()) * sample_rate_hz * 60) >> 32);
+    }
+
+private:
+    static constexpr uint64_t TWO_PI_Q16 = 411775;
+
+    uint64_t phase_ = 0;      // 2^64 per turn
+    int64_t velocity_ = 0;    // 2^64 per turn, per sample
+    int64_t kp_ = 0;
+    int64_t ki_ = 0;
+};
+
+} // namespace FastTrig
+
+#endif // FAST_TRIG_MOTOR_HPP
@@ -0,0 +1,474 @@
+// fast_trig_robotics.hpp - Robot geometry on top of FastTrig
+// Version: 1.0.0
+// License: MIT
+//
+// Dead reckoning and planar arm kinematics in integer arithmetic. Headings
+// and joint angles are binary angles.
+
+#ifndef FAST_TRIG_ROBOTICS_HPP
+#define FAST_TRIG_ROBOTICS_HPP
+
+#include "fast_trig.hpp"
+
+namespace FastTrig {
+
+namespace detail {
+
+// High 64 bits of an unsigned 64x64 product, from 32-bit halves so it does
+// not need a 128-bit type
+constexpr uint64_t mul_hi64(uint64_t a, uint64_t b) noexcept {
+    uint64_t a_lo = uint32_t(a), a_hi = a >> 32;
+    uint64_t b_lo = uint32_t(b), b_hi = b >> 32;
+    uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo, lo_hi = a_lo * b_hi;
+    uint64_t middle = (lo_lo >> 32) + uint32_t(hi_lo) + lo_hi;   // cannot carry out
+    return a_hi * b_hi + (hi_lo >> 32) + (middle >> 32);
+}
+
+// floor(num·2^frac_bits / den) by shift and subtract, for num < den < 2^63.
+// Exact where a double would keep only 53 bits
+constexpr uint64_t scaled_ratio(uint64_t num, uint64_t den, int frac_bits) noexcept {
+    uint64_t quotient = 0;
+    for (int bit = 0; bit < frac_bits; ++bit) {
+        num <<= 1;
+        quotient <<= 1;
+        if (num >= den) {
+            num -= den;
+            quotient |= 1;
+        }
+    }
+    return quotient;
+}
+
+// sin and cos in Q30 of a small angle in Q30 radians, |a| <= 0.1:
+// Taylor series to a^5 and a^6, truncation below 2e-11. Every step rounds
+// to nearest, so repeated rotations keep the vector's length
+constexpr void small_sincos_q30(int64_t a, int64_t& sin_out, int64_t& cos_out) noexcept {
+    constexpr int64_t ONE = int64_t(1) << 30;
+    auto mul = [](int64_t x, int64_t y) { return (x * y + (int64_t(1) << 29)) >> 30; };
+    int64_t a2 = mul(a, a);
+    int64_t s = ONE - (a2 + 10) / 20;
+    s = ONE - (mul(a2, s) + 3) / 6;
+    int64_t c = ONE - (a2 + 15) / 30;
+    c = ONE - (mul(a2, c) + 6) / 12;
+    c = ONE - (mul(a2, c) + 1) / 2;
+    sin_out = mul(a, s);
+    cos_out = c;
+}
+
+// isqrt32 over a block: the same bits, but a fixed number of steps, so
+// the compiler runs the block in SIMD lanes. Overwrites values
+inline void isqrt32_block(uint32_t* values, uint32_t* roots, std::size_t count) noexcept {
+    std::fill(roots, roots + count, 0u);
+    for (uint32_t bit = 1u << 30; bit != 0; bit >>= 2) {
+        for (std::size_t k = 0; k < count; ++k) {
+            uint32_t trial = roots[k] + bit;
+            uint32_t take = -static_cast<uint32_t>(values[k] >= trial);
+            values[k] -= trial & take;
+            roots[k] = (roots[k] >> 1) + (bit & take);
+        }
+    }
+}
+
+// A 64-bit vector shifted down until the larger coordinate fits 15 bits,
+// for the int16 to_polar of TrigImpl
+inline void narrow_vector(int64_t x, int64_t y, int16_t& x_out, int16_t& y_out) noexcept {
+    uint64_t bits = uint64_t(x < 0 ? -x : x) | uint64_t(y < 0 ? -y : y);
+    int shift = std::max(0, 49 - __builtin_clzll(bits | 1));
+    x_out = static_cast<int16_t>(x >> shift);
+    y_out = static_cast<int16_t>(y >> shift);
+}
+
+} // namespace detail
+
+// ============================================================
+// Differential-drive odometry
+// ============================================================
+
+// Dead reckoning from two wheel encoders. Each update takes the ticks both
+// wheels moved since the last one and advances the pose along the exact
+// circular arc they describe:
+//   dθ    = (right - left)·tick / track
+//   chord = (left + right)·tick/2 · sin(dθ/2)/(dθ/2)
+//   x    += chord·cos(θ + dθ/2),  y += chord·sin(θ + dθ/2)
+// The heading is kept as a unit vector in Q30 and turned by dθ/2 twice per
+// update with a short series, so there is no table lookup per update. The
+// exact heading comes from the running tick difference, and every
+// ANCHOR_INTERVAL updates the vector is reset from it with one
+// TrigImpl::sincos, so rounding in the rotations never builds up.
+//
+// Position is Q32 mm in 64 bits: a straight run of any length has no
+// drift beyond the tick length itself. Per update, keep |dθ| <= 0.1 rad
+// and the distance under 30 m. TrigImpl is an IntegerTrig32.
+template<typename TrigImpl = TrigQ31Hermite>
+class Odometry {
+public:
+    using Length = Fixed<15, 16>;     // tick length and track width
+    using Position = Fixed<31, 32>;   // mm, ±2000 km
+
+    struct Pose {
+        Position x;
+        Position y;
+        Angle32 heading;
+
+        constexpr bool operator==(const Pose&) const = default;
+    };
+
+    static constexpr int ANCHOR_INTERVAL = 64;
+
+    // Distance one tick moves a wheel and the distance between the wheels;
+    // the tick must be shorter than the track
+    Odometry(Length tick_length, Length track_width) noexcept
+        : tick_(tick_length.raw()),
+          // turn per tick of difference: tick / track radians, 2^64 per turn
+          phase_per_tick_(detail::mul_hi64(
+              detail::scaled_ratio(uint64_t(tick_length.raw()), uint64_t(track_width.raw()), 64),
+              INV_TWO_PI_Q64)) {
+        reset();
+    }
+
+    void reset(Position x = {}, Position y = {}, Angle32 heading = {}) noexcept {
+        x_ = x.raw();
+        y_ = y.raw();
+        start_phase_ = uint64_t(heading.raw()) << 32;
+        tick_difference_ = 0;
+        anchor();
+    }
+
+    // One encoder sample: ticks each wheel moved since the previous one
+    void update(int32_t left, int32_t right) noexcept {
+        int64_t difference = int64_t(right) - left;
+        tick_difference_ += difference;
+
+        // dθ/2 in Q30 radians: phase units times 2π/2^64, with the /2 and
+        // the Q30 in the shift
+        int64_t turn = static_cast<int64_t>(uint64_t(difference) * phase_per_tick_);
+        int64_t half = ((turn >> 24) * TWO_PI_Q22 + (int64_t(1) << 32)) >> 33;
+
+        int64_t s, c;
+        detail::small_sincos_q30(half, s, c);
+        rotate(s, c);
+
+        // (left + right)·tick in Q16 is twice the arc length; the chord is
+        // shorter by 1 - dθ²/24 = 1 - half²/6, applied to the Q30 heading
+        // since the Q16 travel is too coarse to hold it
+        constexpr int64_t ROUND = int64_t(1) << 29;
+        int64_t chord = (int64_t(1) << 30) - ((half * half + ROUND) >> 30) / 6;
+        int64_t travel = (int64_t(left) + right) * tick_;
+        x_ += (travel * ((cos_ * chord + ROUND) >> 30) + (int64_t(1) << 14)) >> 15;
+        y_ += (travel * ((sin_ * chord + ROUND) >> 30) + (int64_t(1) << 14)) >> 15;
+
+        rotate(s, c);
+        if (++since_anchor_ == ANCHOR_INTERVAL) {
+            anchor();
+        }
+    }
+
+    // Encoder stream; the integration is sequential, so this saves only the
+    // call overhead. Processes the shortest of the spans
+    void update(std::span<const int32_t> left, std::span<const int32_t> right) noexcept {
+        std::size_t count = std::min(left.size(), right.size());
+        for (std::size_t i = 0; i < count; ++i) {
+            update(left[i], right[i]);
+        }
+    }
+
+    // As above, recording the pose after each sample
+    void update(std::span<const int32_t> left, std::span<const int32_t> right,
+                std::span<Pose> path) noexcept {
+        std::size_t count = std::min({left.size(), right.size(), path.size()});
+        for (std::size_t i = 0; i < count; ++i) {
+            update(left[i], right[i]);
+            path[i] = pose();
+        }
+    }
+
+    [[nodiscard]] Position x() const noexcept { return Position::from_raw(x_); }
+    [[nodiscard]] Position y() const noexcept { return Position::from_raw(y_); }
+
+    // From the tick count, not the rotated vector: exact to the rounding
+    // of the turn per tick
+    [[nodiscard]] Angle32 heading() const noexcept {
+        return Angle32::from_raw(static_cast<uint32_t>((phase() + (uint64_t(1) << 31)) >> 32));
+    }
+
+    [[nodiscard]] Pose pose() const noexcept { return {x(), y(), heading()}; }
+
+private:
+    static constexpr uint64_t INV_TWO_PI_Q64 = 2935890503282001226;   // 2^64 / 2π
+    static constexpr int64_t TWO_PI_Q22 = 26353589;
+
+    uint64_t phase() const noexcept {
+        return start_phase_ + uint64_t(tick_difference_) * phase_per_tick_;
+    }
+
+    // Heading vector from the exact phase, Q31 to Q30
+    void anchor() noexcept {
+        int32_t s, c;
+        TrigImpl::sincos(heading().raw(), s, c);
+        sin_ = (int64_t(s) + 1) >> 1;
+        cos_ = (int64_t(c) + 1) >> 1;
+        since_anchor_ = 0;
+    }
+
+    void rotate(int64_t s, int64_t c) noexcept {
+        constexpr int64_t ROUND = int64_t(1) << 29;
+        int64_t next_cos = (cos_ * c - sin_ * s + ROUND) >> 30;
+        sin_ = (sin_ * c + cos_ * s + ROUND) >> 30;
+        cos_ = next_cos;
+    }
+
+    int64_t tick_;                 // Q16 mm
+    uint64_t phase_per_tick_;      // 2^64 per turn
+    uint64_t start_phase_ = 0;
+    int64_t tick_difference_ = 0;  // right - left since reset
+    int64_t x_ = 0, y_ = 0;        // Q32 mm
+    int64_t sin_ = 0, cos_ = 0;    // heading, Q30
+    int since_anchor_ = 0;
+};
+
+// ============================================================
+// Planar arm kinematics
+// ============================================================
+
+// Two- or three-link planar arm: shoulder at the origin, joint angles
+// relative to the previous link, counter-clockwise positive.
+//
+// Inverse kinematics by the law of cosines, with the only division done
+// once at construction: 1/(2·upper·lower) is cached as a 32-bit mantissa
+// and shift. A solve is multiplies, one integer square root and two
+// TrigImpl::to_polar angles (CORDIC, within about one angle unit). The
+// elbow is the angle of (cos, sin) rather than acos(cos): a Q14 acos
+// input leaves a nearly straight arm over 50 units off.
+//
+// Lengths and coordinates share one application unit (mm, 0.01 mm, ...).
+// Link lengths are at least 1 and sum to at most 2^24; targets stay
+// within ±2^30.
+template<typename TrigImpl = Trig>
+class Kinematics {
+public:
+    struct Point {
+        int32_t x;
+        int32_t y;
+
+        constexpr bool operator==(const Point&) const = default;
+    };
+
+    // End effector of a three-link arm: position and the hand's direction
+    struct Pose {
+        Point position;
+        Angle14 orientation;
+
+        constexpr bool operator==(const Pose&) const = default;
+    };
+
+    struct Joints {
+        Angle14 shoulder;
+        Angle14 elbow;
+        Angle14 wrist;   // 0 for two links
+
+        constexpr bool operator==(const Joints&) const = default;
+    };
+
+    // Which of the two solutions: the sign of the elbow angle
+    enum class Elbow { Positive, Negative };
+
+    Kinematics(int32_t upper, int32_t lower, int32_t hand = 0, Elbow elbow = Elbow::Positive) noexcept
+        : upper_(upper), lower_(lower), hand_(hand), elbow_(elbow) {
+        int64_t sum = int64_t(upper) + lower, difference = int64_t(upper) - lower;
+        max_sq_ = sum * sum;
+        min_sq_ = difference * difference;
+
+        // (d² - min²)·2^30 / (2·upper·lower) as (x >> pre_)·reciprocal_ >> post_
+        uint64_t divisor = 2 * uint64_t(upper) * uint64_t(lower);
+        int width = 64 - __builtin_clzll(divisor);
+        reciprocal_ = detail::scaled_ratio(1, divisor, width + 31);
+        pre_ = std::max(0, width - 30);
+        post_ = width + 1 - pre_;
+    }
+
+    // The wrist point of a three-link arm for a two-link check
+    [[nodiscard]] bool reachable(Point target) const noexcept {
+        int64_t d_sq = int64_t(target.x) * target.x + int64_t(target.y) * target.y;
+        return d_sq >= min_sq_ && d_sq <= max_sq_;
+    }
+
+    [[nodiscard]] bool reachable(Pose target) const noexcept {
+        return reachable(wrist_point(target));
+    }
+
+    // First two links to the target, wrist 0. A target out of reach gets
+    // the arm stretched or folded towards it; check reachable() first
+    [[nodiscard]] Joints solve(Point target) const noexcept {
+        ElbowTerms terms = elbow_terms(target);
+        int16_t vectors[4];
+        angle_vectors(target, detail::isqrt32(terms.sin_squared), terms.cosine, vectors);
+        return {Angle14::from_raw(TrigImpl::to_polar(vectors[0], vectors[1]).angle),
+                Angle14::from_raw(TrigImpl::to_polar(vectors[2], vectors[3]).angle), Angle14{}};
+    }
+
+    // All three links: the wrist point is the target minus the hand along
+    // its orientation, the wrist angle makes up the orientation
+    [[nodiscard]] Joints solve(Pose target) const noexcept {
+        Joints joints = solve(wrist_point(target));
+        joints.wrist = target.orientation - joints.shoulder - joints.elbow;
+        return joints;
+    }
+
+    // Trajectories, bit-exact with solve(). Each block of waypoints takes
+    // its square roots together in SIMD lanes, then its atan2 calls, which
+    // overlap where single solves wait on each other. Returns how many
+    // waypoints were out of reach. Processes the shortest of the spans
+    std::size_t solve(std::span<const Point> targets, std::span<Joints> out) const noexcept {
+        return solve_batch(targets, out);
+    }
+
+    std::size_t solve(std::span<const Pose> targets, std::span<Joints> out) const noexcept {
+        return solve_batch(targets, out);
+    }
+
+    // End effector of all three links (the wrist point when hand is 0)
+    [[nodiscard]] Pose forward(Joints joints) const noexcept {
+        Angle14 upper_angle = joints.shoulder;
+        Angle14 lower_angle = upper_angle + joints.elbow;
+        Angle14 hand_angle = lower_angle + joints.wrist;
+        Q14 s1, c1, s2, c2, s3, c3;
+        TrigImpl::sincos(upper_angle, s1, c1);
+        TrigImpl::sincos(lower_angle, s2, c2);
+        TrigImpl::sincos(hand_angle, s3, c3);
+        return {end_point(s1.raw(), c1.raw(), s2.raw(), c2.raw(), s3.raw(), c3.raw()), hand_angle};
+    }
+
+    // Trajectories through TrigImpl::sincos_batch, bit-exact with
+    // forward(). Processes the shortest of the spans
+    void forward(std::span<const Joints> joints, std::span<Pose> out) const noexcept {
+        std::size_t count = std::min(joints.size(), out.size());
+        uint16_t angles[3][BLOCK];
+        int16_t sines[3][BLOCK], cosines[3][BLOCK];
+        for (std::size_t start = 0; start < count; start += BLOCK) {
+            std::size_t n = std::min(BLOCK, count - start);
+            for (std::size_t k = 0; k < n; ++k) {
+                const Joints& j = joints[start + k];
+                angles[0][k] = j.shoulder.raw();
+                angles[1][k] = (j.shoulder + j.elbow).raw();
+                angles[2][k] = (j.shoulder + j.elbow + j.wrist).raw();
+            }
+            for (int link = 0; link < 3; ++link) {
+                TrigImpl::sincos_batch(std::span<const uint16_t>(angles[link], n),
+                                       std::span<int16_t>(sines[link], n), std::span<int16_t>(cosines[link], n));
+            }
+            for (std::size_t k = 0; k < n; ++k) {
+                out[start + k] = {end_point(sines[0][k], cosines[0][k], sines[1][k], cosines[1][k],
+                                            sines[2][k], cosines[2][k]),
+                                  Angle14::from_raw(angles[2][k])};
+            }
+        }
+    }
+
+private:
+    static constexpr std::size_t BLOCK = 256;
+    static constexpr int64_t TWO_Q30 = int64_t(1) << 31;
+
+    struct ElbowTerms {
+        int32_t cosine;         // Q15
+        uint32_t sin_squared;   // Q30
+    };
+
+    // Law of cosines with the cached reciprocal, as 1 + cos and 1 - cos in
+    // Q30: sin² = (1 + cos)(1 - cos), cos = ((1 + cos) - (1 - cos)) / 2
+    ElbowTerms elbow_terms(Point target) const noexcept {
+        int64_t d_sq = int64_t(target.x) * target.x + int64_t(target.y) * target.y;
+        d_sq = std::clamp(d_sq, min_sq_, max_sq_);
+        int64_t plus = static_cast<int64_t>((uint64_t(d_sq - min_sq_) >> pre_) * reciprocal_ >> post_);
+        plus = std::min(plus, TWO_Q30);
+        int64_t minus = TWO_Q30 - plus;
+        return {static_cast<int32_t>((plus - minus) >> 16), static_cast<uint32_t>((plus * minus) >> 30)};
+    }
+
+    // Elbow from its Q15 sin and cos; shoulder = angle of the target -
+    // angle of the bent arm, one angle of the target times the conjugate
+    // of the arm vector. Both as int16 vectors for TrigImpl::to_polar
+    void angle_vectors(Point target, int64_t sin_elbow, int64_t cos_elbow, int16_t (&vectors)[4]) const noexcept {
+        if (elbow_ == Elbow::Negative) {
+            sin_elbow = -sin_elbow;
+        }
+        int64_t arm_x = (upper_ << 15) + lower_ * cos_elbow, arm_y = lower_ * sin_elbow;
+        uint64_t bits = uint64_t(arm_x < 0 ? -arm_x : arm_x) | uint64_t(arm_y < 0 ? -arm_y : arm_y);
+        int shift = std::max(0, 33 - __builtin_clzll(bits | 1));
+        arm_x >>= shift;
+        arm_y >>= shift;
+        int64_t x = target.x, y = target.y;
+        detail::narrow_vector(x * arm_x + y * arm_y, y * arm_x - x * arm_y, vectors[0], vectors[1]);
+        detail::narrow_vector(cos_elbow, sin_elbow, vectors[2], vectors[3]);
+    }
+
+    template<typename Target>
+    std::size_t solve_batch(std::span<const Target> targets, std::span<Joints> out) const noexcept {
+        std::size_t count = std::min(targets.size(), out.size());
+        std::size_t unreachable = 0;
+        Point points[BLOCK];
+        int32_t cosines[BLOCK];
+        uint32_t squares[BLOCK], roots[BLOCK];
+        int16_t xs[2][BLOCK], ys[2][BLOCK];
+        uint16_t angles[2][BLOCK];
+        int32_t lengths[BLOCK];
+        for (std::size_t start = 0; start < count; start += BLOCK) {
+            std::size_t n = std::min(BLOCK, count - start);
+            for (std::size_t k = 0; k < n; ++k) {
+                if constexpr (std::same_as<Target, Pose>) {
+                    points[k] = wrist_point(targets[start + k]);
+                } else {
+                    points[k] = targets[start + k];
+                }
+                unreachable += !reachable(points[k]);
+                ElbowTerms terms = elbow_terms(points[k]);
+                cosines[k] = terms.cosine;
+                squares[k] = terms.sin_squared;
+            }
+            detail::isqrt32_block(squares, roots, n);
+            for (std::size_t k = 0; k < n; ++k) {
+                int16_t vectors[4];
+                angle_vectors(points[k], roots[k], cosines[k], vectors);
+                xs[0][k] = vectors[0];
+                ys[0][k] = vectors[1];
+                xs[1][k] = vectors[2];
+                ys[1][k] = vectors[3];
+            }
+            for (int joint = 0; joint < 2; ++joint) {
+                TrigImpl::to_polar_batch(std::span<const int16_t>(xs[joint], n), std::span<const int16_t>(ys[joint], n),
+                                         std::span<uint16_t>(angles[joint], n), std::span<int32_t>(lengths, n));
+            }
+            for (std::size_t k = 0; k < n; ++k) {
+                Joints joints{Angle14::from_raw(angles[0][k]), Angle14::from_raw(angles[1][k]), Angle14{}};
+                if constexpr (std::same_as<Target, Pose>) {
+                    joints.wrist = targets[start + k].orientation - joints.shoulder - joints.elbow;
+                }
+                out[start + k] = joints;
+            }
+        }
+        return unreachable;
+    }
+
+    Point wrist_point(Pose target) const noexcept {
+        Q14 s, c;
+        TrigImpl::sincos(target.orientation, s, c);
+        return {target.position.x - static_cast<int32_t>((int64_t(hand_) * c.raw() + 8192) >> 14),
+                target.position.y - static_cast<int32_t>((int64_t(hand_) * s.raw() + 8192) >> 14)};
+    }
+
+    // Sum of the links along their Q14 directions, rounded
+    Point end_point(int32_t s1, int32_t c1, int32_t s2, int32_t c2, int32_t s3, int32_t c3) const noexcept {
+        int64_t x = int64_t(upper_) * c1 + int64_t(lower_) * c2 + int64_t(hand_) * c3;
+        int64_t y = int64_t(upper_) * s1 + int64_t(lower_) * s2 + int64_t(hand_) * s3;
+        return {static_cast<int32_t>((x + 8192) >> 14), static_cast<int32_t>((y + 8192) >> 14)};
+    }
+
+    int64_t upper_, lower_, hand_;
+    Elbow elbow_;
+    int64_t min_sq_, max_sq_;   // squared reach limits
+    uint64_t reciprocal_;       // 2^(width + 31) / (2·upper·lower)
+    int pre_, post_;
+};
+
+} // namespace FastTrig
+
+#endif // FAST_TRIG_ROBOTICS_HPP
@@ -0,0 +1,208 @@
+// benchmark_3d.cpp - Accuracy and speed of fast_trig_3d.hpp against float
+//
+// Rotates random int16 vectors by random attitudes three ways: Rot3 built
+// from Euler angles, Rot3 built through Quaternion<14> and Quaternion<30>,
+// and a float matrix from <cmath>. Errors are against a double reference,
+// in output LSB. Timings are ns per vector (batches) or per call, best of
+// several runs.
+
+#include "fast_trig_3d.hpp"
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace FastTrig;
+using Vec3 = Vector3D::Vec3;
+
+namespace {
+
+uint32_t seed = 2024;
+
+uint32_t next_random() {
+    seed = seed * 1664525u + 1013904223u;
+    return seed >> 8;
+}
+
+// Pitch kept within ±80° so Euler round trips stay away from gimbal lock
+EulerAngles random_attitude() {
+    return {Angle14::from_raw(next_random()), Angle14::from_raw(uint32_t(int(next_random() % 7282) - 3641)),
+            Angle14::from_raw(next_random())};
+}
+
+template<typename Real>
+std::array<Real, 9> reference_matrix(EulerAngles e) {
+    Real r = Real(e.roll.to_signed() * M_PI / 8192);
+    Real p = Real(e.pitch.to_signed() * M_PI / 8192);
+    Real y = Real(e.yaw.to_signed() * M_PI / 8192);
+    Real sr = std::sin(r), cr = std::cos(r), sp = std::sin(p), cp = std::cos(p);
+    Real sy = std::sin(y), cy = std::cos(y);
+    return {cy * cp, cy * sp * sr - sy * cr, cy * sp * cr + sy * sr,
+            sy * cp, sy * sp * sr + cy * cr, sy * sp * cr - cy * sr,
+            -sp,     cp * sr,                cp * cr};
+}
+
+struct ErrorStats {
+    double max = 0;
+    double sum_squared = 0;
+    int count = 0;
+
+    void add(double error) {
+        max = std::max(max, std::abs(error));
+        sum_squared += error * error;
+        ++count;
+    }
+    double rms() const { return std::sqrt(sum_squared / count); }
+};
+
+template<typename F>
+double best_ns(F&& run, double ops) {
+    double best = 1e30;
+    for (int attempt = 0; attempt < 5; ++attempt) {
+        auto start = std::chrono::high_resolution_clock::now();
+        run();
+        auto stop = std::chrono::high_resolution_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count() / ops);
+    }
+    return best;
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "3-D rotation: accuracy (LSB against double, |v| <= 20000)\n";
+
+    ErrorStats from_euler, via_q14, via_q30, float_matrix;
+    int round_trip = 0;
+    for (int i = 0; i < 20000; ++i) {
+        EulerAngles e = random_attitude();
+        auto exact = reference_matrix<double>(e);
+        auto single = reference_matrix<float>(e);
+        Rot3 direct = Rot3::from_euler(e);
+        Rot3 q14 = Rot3::from_quaternion(Quaternion<14>::from_euler(e));
+        Rot3 q30 = Rot3::from_quaternion(Quaternion<30>::from_euler(e));
+
+        Vec3 v{static_cast<int16_t>(int(next_random() % 23094) - 11547),
+               static_cast<int16_t>(int(next_random() % 23094) - 11547),
+               static_cast<int16_t>(int(next_random() % 23094) - 11547)};
+        Vec3 a = direct.apply(v), b = q14.apply(v), c = q30.apply(v);
+        int16_t got_a[3] = {a.x, a.y, a.z}, got_b[3] = {b.x, b.y, b.z}, got_c[3] = {c.x, c.y, c.z};
+        for (int row = 0; row < 3; ++row) {
+            double expected = exact[3 * row] * v.x + exact[3 * row + 1] * v.y + exact[3 * row + 2] * v.z;
+            float approx = single[3 * row] * v.x + single[3 * row + 1] * v.y + single[3 * row + 2] * v.z;
+            from_euler.add(got_a[row] - expected);
+            via_q14.add(got_b[row] - expected);
+            via_q30.add(got_c[row] - expected);
+            float_matrix.add(std::nearbyint(approx) - expected);
+        }
+
+        EulerAngles back = Quaternion<30>::from_euler(e).to_euler();
+        round_trip = std::max({round_trip, std::abs((back.roll - e.roll).to_signed()),
+                               std::abs((back.pitch - e.pitch).to_signed()),
+                               std::abs((back.yaw - e.yaw).to_signed())});
+    }
+
+    auto report = [](const char* name, const ErrorStats& s) {
+        std::cout << "  " << std::left << std::setw(28) << name << std::right
+                  << "max " << std::setw(6) << s.max << "  rms " << std::setw(5) << s.rms() << "\n";
+    };
+    report("Rot3::from_euler", from_euler);
+    report("Rot3 via Quaternion<14>", via_q14);
+    report("Rot3 via Quaternion<30>", via_q30);
+    report("float matrix (<cmath>)", float_matrix);
+    std::cout << "  Euler -> Quaternion<30> -> Euler: " << round_trip << " units max\n\n";
+
+    // Throughput
+    const std::size_t points = 4096;
+    std::vector<Vec3> aos(points);
+    std::vector<int16_t> xs(points), ys(points), zs(points);
+    std::vector<float> fx(points), fy(points), fz(points);
+    for (std::size_t i = 0; i < points; ++i) {
+        aos[i] = {static_cast<int16_t>(next_random()), static_cast<int16_t>(next_random()),
+                  static_cast<int16_t>(next_random())};
+        xs[i] = aos[i].x;
+        ys[i] = aos[i].y;
+        zs[i] = aos[i].z;
+        fx[i] = xs[i];
+        fy[i] = ys[i];
+        fz[i] = zs[i];
+    }
+
+    EulerAngles attitude = random_attitude();
+    Rot3 rotation = Rot3::from_euler(attitude);
+    auto fm = reference_matrix<float>(attitude);
+    const int rounds = 200;
+    const double vector_ops = double(rounds) * points;
+
+    volatile int32_t sink = 0;
+
+    // Each round rotates the previous output, so no round can be skipped
+    std::cout << "3-D rotation: throughput (ns)\n";
+    double soa = best_ns([&] {
+        for (int r = 0; r < rounds; ++r) rotation.apply(xs, ys, zs, xs, ys, zs);
+        sink = xs[0];
+    }, vector_ops);
+    double aos_ns = best_ns([&] {
+        for (int r = 0; r < rounds; ++r) rotation.apply(aos, aos);
+        sink = aos[0].x;
+    }, vector_ops);
+    double float_ns = best_ns([&] {
+        for (int r = 0; r < rounds; ++r) {
+            for (std::size_t i = 0; i < points; ++i) {
+                float x = fx[i], y = fy[i], z = fz[i];
+                fx[i] = fm[0] * x + fm[1] * y + fm[2] * z;
+                fy[i] = fm[3] * x + fm[4] * y + fm[5] * z;
+                fz[i] = fm[6] * x + fm[7] * y + fm[8] * z;
+            }
+        }
+        sink = static_cast<int32_t>(fx[0]);
+    }, vector_ops);
+    std::cout << "  Rot3::apply SoA batch     " << std::setw(6) << soa << " per vector\n";
+    std::cout << "  Rot3::apply AoS batch     " << std::setw(6) << aos_ns << " per vector\n";
+    std::cout << "  float matrix SoA loop     " << std::setw(6) << float_ns << " per vector\n";
+
+    // Per-update costs of an attitude filter
+    std::vector<EulerAngles> attitudes(1024);
+    for (auto& e : attitudes) e = random_attitude();
+    const double update_ops = double(rounds) * attitudes.size();
+
+    double quat_from_euler = best_ns([&] {
+        for (int r = 0; r < rounds; ++r) {
+            int32_t acc = 0;
+            for (const auto& e : attitudes) acc += Quaternion<30>::from_euler(e).w.raw();
+            sink = acc;
+        }
+    }, update_ops);
+    double float_from_euler = best_ns([&] {
+        for (int r = 0; r < rounds; ++r) {
+            float acc = 0;
+            for (const auto& e : attitudes) {
+                float hr = float(e.roll.raw() * M_PI / 16384), hp = float(e.pitch.raw() * M_PI / 16384);
+                float hy = float(e.yaw.raw() * M_PI / 16384);
+                float sr = std::sin(hr), cr = std::cos(hr), sp = std::sin(hp), cp = std::cos(hp);
+                float sy = std::sin(hy), cy = std::cos(hy);
+                float w = cr * cp * cy + sr * sp * sy, x = sr * cp * cy - cr * sp * sy;
+                float y = cr * sp * cy + sr * cp * sy, z = cr * cp * sy - sr * sp * cy;
+                acc += w + x + y + z;
+            }
+            sink = static_cast<int32_t>(acc);
+        }
+    }, update_ops);
+
+    Quaternion<30> step = Quaternion<30>::from_euler(attitudes[0]);
+    double quat_multiply = best_ns([&] {
+        Quaternion<30> q = Quaternion<30>::identity();
+        for (int r = 0; r < rounds; ++r) {
+            for (std::size_t i = 0; i < attitudes.size(); ++i) q *= step;
+            q = q.normalized();
+        }
+        sink = q.w.raw();
+    }, update_ops);
+
+    std::cout << "  Quaternion<30>::from_euler " << std::setw(5) << quat_from_euler << " per call"
+              << " (float <cmath>: " << float_from_euler << ")\n";
+    std::cout << "  Quaternion<30> multiply    " << std::setw(5) << quat_multiply << " per call\n";
+    return 0;
+}
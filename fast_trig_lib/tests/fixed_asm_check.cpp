@@ -0,0 +1,68 @@
+// fixed_asm_check.cpp - Fixed<> against the hand-written shifts it replaces
+//
+// Each manual_* / fixed_* pair must compile to the same instructions;
+// `make asm-diff` builds this file with the `asm` target and compares the
+// function bodies. Not linked into any program.
+
+#include "fast_trig.hpp"
+
+using namespace FastTrig;
+
+using Coord = Fixed<15, 0, int16_t>;
+
+struct Pair {
+    int16_t a, b;
+};
+
+// Sine and cosine are passed in, so that only the arithmetic is compared
+
+// Vector2D::rotate
+extern "C" Pair manual_rotate(int16_t x, int16_t y, int16_t sin_a, int16_t cos_a) {
+    return {static_cast<int16_t>((int32_t(x) * cos_a - int32_t(y) * sin_a) >> 14),
+            static_cast<int16_t>((int32_t(x) * sin_a + int32_t(y) * cos_a) >> 14)};
+}
+
+extern "C" Pair fixed_rotate(int16_t x, int16_t y, int16_t sin_a, int16_t cos_a) {
+    Coord cx(x), cy(y);
+    Q14 s = Q14::from_raw(sin_a), c = Q14::from_raw(cos_a);
+    return {fixed_cast<Coord>(cx * c - cy * s).raw(), fixed_cast<Coord>(cx * s + cy * c).raw()};
+}
+
+// Park transform, widened before multiplying
+extern "C" Pair manual_park(int16_t alpha, int16_t beta, int16_t sin_t, int16_t cos_t) {
+    return {static_cast<int16_t>((int32_t(alpha) * cos_t + int32_t(beta) * sin_t) >> 14),
+            static_cast<int16_t>((int32_t(beta) * cos_t - int32_t(alpha) * sin_t) >> 14)};
+}
+
+extern "C" Pair fixed_park(int16_t alpha, int16_t beta, int16_t sin_t, int16_t cos_t) {
+    Coord a(alpha), b(beta);
+    Q14 s = Q14::from_raw(sin_t), c = Q14::from_raw(cos_t);
+    return {fixed_cast<Coord>(a * c + b * s).raw(), fixed_cast<Coord>(b * c - a * s).raw()};
+}
+
+// Division by 16384 rounds toward zero
+extern "C" int16_t manual_scale_trunc(int16_t length, int16_t cos_value) {
+    return static_cast<int16_t>((int32_t(length) * cos_value) / 16384);
+}
+
+extern "C" int16_t fixed_scale_trunc(int16_t length, int16_t cos_value) {
+    return fixed_cast<Coord, RoundToZero>(Coord(length) * Q14::from_raw(cos_value)).raw();
+}
+
+// Round to nearest
+extern "C" int16_t manual_scale_round(int16_t length, int16_t cos_value) {
+    return static_cast<int16_t>((int32_t(length) * cos_value + (1 << 13)) >> 14);
+}
+
+extern "C" int16_t fixed_scale_round(int16_t length, int16_t cos_value) {
+    return fixed_cast<Coord, RoundNearest>(Coord(length) * Q14::from_raw(cos_value)).raw();
+}
+
+// Q14 × Q14 back to Q14
+extern "C" int16_t manual_mul_q14(int16_t a, int16_t b) {
+    return static_cast<int16_t>((int32_t(a) * b) >> 14);
+}
+
+extern "C" int16_t fixed_mul_q14(int16_t a, int16_t b) {
+    return fixed_cast<Q14>(Q14::from_raw(a) * Q14::from_raw(b)).raw();
+}
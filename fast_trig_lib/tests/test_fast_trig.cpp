@@ -1,8 +1,14 @@
 // test_fast_trig.cpp - Unit tests for FastTrig library
 
 #include "fast_trig.hpp"
+#include "fast_trig_dsp.hpp"
+#include "fast_trig_3d.hpp"
+#include "fast_trig_motor.hpp"
+#include "fast_trig_robotics.hpp"
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <complex>
 #include <iostream>
 #include <iomanip>
 #include <vector>
@@ -105,6 +111,93 @@ void test_atan2() {
     std::cout << "  ✓ All atan2 tests passed\n\n";
 }
 
+// Max atan2 error in angle units over circles of several radii (all
+// octants) and a grid of the int16 plane
+template<typename TrigImpl>
+double atan2_max_error() {
+    double max_error = 0;
+    auto check = [&](int16_t y, int16_t x) {
+        double expected = std::atan2(double(y), double(x)) * 16384.0 / (2.0 * M_PI);
+        if (expected < 0) expected += 16384.0;
+        
+        double error = std::abs(TrigImpl::atan2(y, x) - expected);
+        if (error > 8192) error = 16384 - error;
+        max_error = std::max(max_error, error);
+    };
+    for (int radius : {1000, 12345, 32767}) {
+        for (int k = 0; k < 16384; ++k) {
+            double a = 2.0 * M_PI * k / 16384.0;
+            check(static_cast<int16_t>(std::lround(radius * std::sin(a))),
+                  static_cast<int16_t>(std::lround(radius * std::cos(a))));
+        }
+    }
+    for (int y = -32768; y < 32768; y += 61) {
+        for (int x = -32768; x < 32768; x += 67) {
+            if (x != 0 || y != 0) check(static_cast<int16_t>(y), static_cast<int16_t>(x));
+        }
+    }
+    return max_error;
+}
+
+// Test the division-free atan2 policies
+void test_atan2_policies() {
+    std::cout << "Testing atan2 policies...\n";
+    
+    double divide_error = atan2_max_error<IntegerTrig<128, AtanDivide>>();
+    double reciprocal_error = atan2_max_error<IntegerTrig<128, AtanReciprocal>>();
+    double cordic_error = atan2_max_error<IntegerTrig<128, AtanCordic>>();
+    
+    std::cout << "  Max error (angle units): divide=" << std::setprecision(3) << divide_error
+              << ", reciprocal=" << reciprocal_error
+              << ", cordic=" << cordic_error << "\n";
+    
+    assert(divide_error < 2.0);
+    assert(reciprocal_error < 2.0);
+    assert(cordic_error < 2.0);
+    
+    // Axes and diagonals map exactly
+    using Recip = IntegerTrig<128, AtanReciprocal>;
+    using Cordic = IntegerTrig<128, AtanCordic>;
+    assert(Recip::atan2(1000, 1000) == 2048 && Cordic::atan2(1000, 1000) == 2048);
+    assert(Recip::atan2(0, -1000) == 8192 && Cordic::atan2(0, -1000) == 8192);
+    assert(Recip::atan2(-1000, 0) == 12288 && Cordic::atan2(-1000, 0) == 12288);
+    assert(Recip::atan2(0, 0) == 0 && Cordic::atan2(0, 0) == 0);
+    assert(Recip::atan2(-32768, -32768) == 10240 && Cordic::atan2(-32768, -32768) == 10240);
+    
+    // Reciprocal ratio stays within one unit of the divided ratio
+    for (int y = -32768; y < 32768; y += 97) {
+        for (int x = -32768; x < 32768; x += 89) {
+            int a = Trig128::atan2(y, x);
+            int b = Recip::atan2(y, x);
+            int d = std::abs(a - b);
+            assert(d <= 1 || d == 16383);
+        }
+    }
+    
+    // Octant folding is exact: reflections about the axes and the diagonal
+    // reproduce the first-octant result for every policy
+    auto octant_symmetric = []<typename T>() {
+        for (int y = 0; y < 32768; y += 103) {
+            for (int x = y + 1; x < 32768; x += 107) {
+                uint16_t a = T::atan2(y, x);
+                if (T::atan2(x, y) != ((4096 - a) & 0x3FFF) ||
+                    T::atan2(-y, x) != ((16384 - a) & 0x3FFF) ||
+                    T::atan2(y, -x) != ((8192 - a) & 0x3FFF) ||
+                    T::atan2(-y, -x) != ((8192 + a) & 0x3FFF)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+    assert(octant_symmetric.template operator()<Trig128>());
+    assert(octant_symmetric.template operator()<Recip>());
+    assert(octant_symmetric.template operator()<Cordic>());
+    assert(Trig128::atan2(-32768, 0) == 12288 && Trig128::atan2(0, -32768) == 8192);
+    
+    std::cout << "  ✓ atan2 policy tests passed\n\n";
+}
+
 // Test inverse functions
 void test_inverse() {
     std::cout << "Testing inverse trigonometric functions...\n";
@@ -141,8 +234,8 @@ void test_inverse() {
         uint16_t asin_val = Trig128::asin(i);
         uint16_t acos_val = Trig128::acos(i);
         
-        // Should sum to π/2 (4096 in our units)
-        int sum = asin_val + acos_val;
+        // Should sum to π/2 (4096 in our units), modulo a full turn
+        int sum = (asin_val + acos_val) & 0x3FFF;
         int error = std::abs(sum - 4096);
         
         if (error > 10) {
@@ -204,9 +297,127 @@ void test_magnitude() {
         }
     }
     
+    // Small vectors are normalised before the CORDIC steps, so they come
+    // out exact rather than swamped by truncation
+    assert(Trig128::magnitude(1, 0) == 1);
+    assert(Trig128::magnitude(7, 0) == 7);
+    assert(Trig128::magnitude(0, 10) == 10);
+    assert(Trig128::magnitude(30, 40) == 50);
+    assert(Trig128::magnitude(-3, 4) == 5);
+    assert(Trig128::magnitude(0, 0) == 0);
+    
     std::cout << "  ✓ All magnitude tests passed\n\n";
 }
 
+// Test magnitude methods and the batch kernel
+void test_magnitude_batch() {
+    std::cout << "Testing magnitude methods and batch...\n";
+    
+    // Documented bounds: CORDIC < 0.001% + 1 LSB, alpha-beta < 1% + 2 LSB
+    double cordic_excess = 0;
+    double alpha_beta_excess = 0;
+    double alpha_beta_max = 0;
+    for (int k = 0; k < 4096; ++k) {
+        double a = 2.0 * M_PI * k / 4096.0;
+        for (double radius : {3.0, 100.0, 5000.0, 1.0e6, 5.0e8, 2.0e9}) {
+            int32_t x = static_cast<int32_t>(std::lround(radius * std::cos(a)));
+            int32_t y = static_cast<int32_t>(std::lround(radius * std::sin(a)));
+            double expected = std::hypot(double(x), double(y));
+            
+            double cordic = Trig128::magnitude(x, y);
+            double fast = Trig128::magnitude<MagnitudeAlphaBeta>(x, y);
+            
+            cordic_excess = std::max(cordic_excess, std::abs(cordic - expected) - (0.00001 * expected + 1));
+            alpha_beta_excess = std::max(alpha_beta_excess, std::abs(fast - expected) - (0.01 * expected + 2));
+            if (radius >= 5000.0) {
+                alpha_beta_max = std::max(alpha_beta_max, std::abs(fast - expected) / expected);
+            }
+        }
+    }
+    std::cout << "  Alpha-beta max relative error (radius >= 5000): " << std::setprecision(3)
+              << alpha_beta_max * 100 << "%\n";
+    assert(cordic_excess <= 0);
+    assert(alpha_beta_excess <= 0);
+    
+    // Batch is bit-exact with the scalar method, including blocks that
+    // exceed the SIMD lane range and an odd-sized tail
+    std::vector<int32_t> xs, ys;
+    uint32_t seed = 7;
+    for (int k = 0; k < 10007; ++k) {
+        seed = seed * 1664525u + 1013904223u;
+        xs.push_back(static_cast<int32_t>(seed) >> (1 + (seed & 15)));
+        seed = seed * 1664525u + 1013904223u;
+        ys.push_back(static_cast<int32_t>(seed) >> (1 + (seed & 15)));
+    }
+    xs[100] = INT32_MAX / 2;
+    ys[200] = -(INT32_MAX / 2);
+    
+    std::vector<int32_t> cordic_out(xs.size());
+    std::vector<int32_t> fast_out(xs.size());
+    Trig128::magnitude_batch(xs, ys, cordic_out);
+    Trig128::magnitude_batch<MagnitudeAlphaBeta>(xs, ys, fast_out);
+    for (std::size_t i = 0; i < xs.size(); ++i) {
+        assert(cordic_out[i] == Trig128::magnitude(xs[i], ys[i]));
+        assert(fast_out[i] == Trig128::magnitude<MagnitudeAlphaBeta>(xs[i], ys[i]));
+    }
+    
+    std::cout << "  ✓ Magnitude method and batch tests passed\n\n";
+}
+
+// Test combined angle + magnitude from one CORDIC pass
+void test_to_polar() {
+    std::cout << "Testing to_polar (CORDIC vectoring)...\n";
+    
+    double max_angle_error = 0;
+    double max_magnitude_error = 0;
+    uint32_t seed = 1;
+    for (int k = 0; k < 100000; ++k) {
+        seed = seed * 1664525u + 1013904223u;
+        int32_t x = static_cast<int32_t>(seed) >> (seed & 15);
+        seed = seed * 1664525u + 1013904223u;
+        int32_t y = static_cast<int32_t>(seed) >> (seed & 15);
+        
+        auto polar = Trig128::to_polar(x, y);
+        
+        double expected_angle = std::atan2(double(y), double(x)) * 16384.0 / (2.0 * M_PI);
+        if (expected_angle < 0) expected_angle += 16384.0;
+        double angle_error = std::abs(polar.angle - expected_angle);
+        if (angle_error > 8192) angle_error = 16384 - angle_error;
+        
+        double expected_magnitude = std::hypot(double(x), double(y));
+        double magnitude_error = std::abs(polar.magnitude - expected_magnitude) / expected_magnitude;
+        
+        max_angle_error = std::max(max_angle_error, angle_error);
+        max_magnitude_error = std::max(max_magnitude_error, magnitude_error);
+    }
+    
+    std::cout << "  Max angle error: " << std::setprecision(3) << max_angle_error << " units\n";
+    std::cout << "  Max magnitude error: " << std::setprecision(6) << max_magnitude_error * 100 << "%\n";
+    assert(max_angle_error < 1.0);
+    assert(max_magnitude_error < 0.0001);
+    
+    // Edge cases: origin, axes, extreme values
+    assert(Trig128::to_polar(0, 0).angle == 0 && Trig128::to_polar(0, 0).magnitude == 0);
+    assert(Trig128::to_polar(0, 5).angle == 4096 && Trig128::to_polar(0, 5).magnitude == 5);
+    assert(Trig128::to_polar(-7, 0).angle == 8192 && Trig128::to_polar(-7, 0).magnitude == 7);
+    assert(Trig128::to_polar(3, 4).magnitude == 5);
+    assert(Trig128::to_polar(INT32_MIN, 0).magnitude >= INT32_MAX - 16);
+    assert(Trig128::to_polar(INT32_MIN, INT32_MIN).magnitude == INT32_MAX);
+    
+    // Vector2D round trip
+    using V = Vector2D<Trig128>;
+    for (int deg = 0; deg < 360; deg += 15) {
+        V::Vec2 v = V::from_polar({AngleConvert::from_degrees(deg), 10000});
+        V::Polar p = V::to_polar(v);
+        int angle_diff = std::abs(int(p.angle) - int(AngleConvert::from_degrees(deg)));
+        if (angle_diff > 8192) angle_diff = 16384 - angle_diff;
+        assert(angle_diff <= 2);
+        assert(std::abs(p.magnitude - 10000) <= 2);
+    }
+    
+    std::cout << "  ✓ to_polar tests passed\n\n";
+}
+
 // Test special angle values
 void test_special_angles() {
     std::cout << "Testing special angle values...\n";
@@ -239,8 +450,8 @@ void test_special_angles() {
     
     for (const auto& test : special_angles) {
         uint16_t angle = AngleConvert::from_degrees(test.degrees);
-        double sin_val = Trig128::sin(angle) / 16384.0 * 2.0;
-        double cos_val = Trig128::cos(angle) / 16384.0 * 2.0;
+        double sin_val = Trig128::sin(angle) / 16384.0;
+        double cos_val = Trig128::cos(angle) / 16384.0;
         
         std::cout << "  " << std::setw(3) << test.degrees << "°: "
                   << "sin=" << std::fixed << std::setprecision(3) 
@@ -277,20 +488,20 @@ void test_table_sizes() {
     
     double expected = 0.5;
     
-    std::cout << "    Trig32:  " << (sin32 / 16384.0 * 2.0) 
-              << " (error: " << std::abs((sin32 / 16384.0 * 2.0) - expected) << ")\n";
-    std::cout << "    Trig64:  " << (sin64 / 16384.0 * 2.0) 
-              << " (error: " << std::abs((sin64 / 16384.0 * 2.0) - expected) << ")\n";
-    std::cout << "    Trig128: " << (sin128 / 16384.0 * 2.0) 
-              << " (error: " << std::abs((sin128 / 16384.0 * 2.0) - expected) << ")\n";
-    std::cout << "    Trig256: " << (sin256 / 16384.0 * 2.0) 
-              << " (error: " << std::abs((sin256 / 16384.0 * 2.0) - expected) << ")\n";
+    std::cout << "    Trig32:  " << (sin32 / 16384.0) 
+              << " (error: " << std::abs((sin32 / 16384.0) - expected) << ")\n";
+    std::cout << "    Trig64:  " << (sin64 / 16384.0) 
+              << " (error: " << std::abs((sin64 / 16384.0) - expected) << ")\n";
+    std::cout << "    Trig128: " << (sin128 / 16384.0) 
+              << " (error: " << std::abs((sin128 / 16384.0) - expected) << ")\n";
+    std::cout << "    Trig256: " << (sin256 / 16384.0) 
+              << " (error: " << std::abs((sin256 / 16384.0) - expected) << ")\n";
     
     // Verify accuracy improves with table size
-    double error32 = std::abs((sin32 / 16384.0 * 2.0) - expected);
-    double error64 = std::abs((sin64 / 16384.0 * 2.0) - expected);
-    double error128 = std::abs((sin128 / 16384.0 * 2.0) - expected);
-    double error256 = std::abs((sin256 / 16384.0 * 2.0) - expected);
+    double error32 = std::abs((sin32 / 16384.0) - expected);
+    double error64 = std::abs((sin64 / 16384.0) - expected);
+    double error128 = std::abs((sin128 / 16384.0) - expected);
+    double error256 = std::abs((sin256 / 16384.0) - expected);
     
     assert(error256 <= error128);
     assert(error128 <= error64);
@@ -300,6 +511,20 @@ void test_table_sizes() {
 }
 
 // Test sincos simultaneous calculation
+template<typename TrigImpl>
+bool sincos_matches_separate() {
+    for (uint32_t angle = 0; angle < 65536; ++angle) {
+        int16_t sin_simul, cos_simul;
+        TrigImpl::sincos(angle, sin_simul, cos_simul);
+        if (sin_simul != TrigImpl::sin(angle) || cos_simul != TrigImpl::cos(angle)) {
+            std::cout << "  ✗ Mismatch at angle " << angle << " (table size "
+                      << TrigImpl::table_size() << ")\n";
+            return false;
+        }
+    }
+    return true;
+}
+
 void test_sincos() {
     std::cout << "Testing simultaneous sin/cos calculation...\n";
     
@@ -326,9 +551,1476 @@ void test_sincos() {
         }
     }
     
+    // Fused kernel must agree with sin()/cos() for every angle
+    bool ok = sincos_matches_separate<Trig32>() &&
+              sincos_matches_separate<Trig128>() &&
+              sincos_matches_separate<Trig512>() &&
+              sincos_matches_separate<IntegerTrig<8>>();
+    assert(ok);
+    
+    // Usable in constant expressions
+    constexpr auto quarter = [] {
+        int16_t s = 0, c = 0;
+        Trig128::sincos(4096, s, c);
+        return std::array<int16_t, 2>{s, c};
+    }();
+    static_assert(quarter[0] == 16384 && quarter[1] == 0);
+    
     std::cout << "  ✓ sincos test passed\n\n";
 }
 
+// Test batch functions against the scalar path
+template<typename TrigImpl>
+bool batch_matches_scalar(const std::vector<uint16_t>& angles) {
+    std::vector<int16_t> sin_out(angles.size());
+    std::vector<int16_t> cos_out(angles.size());
+    std::vector<int16_t> sin_pair(angles.size());
+    std::vector<int16_t> cos_pair(angles.size());
+    
+    TrigImpl::sin_batch(angles, sin_out);
+    TrigImpl::cos_batch(angles, cos_out);
+    TrigImpl::sincos_batch(angles, sin_pair, cos_pair);
+    
+    for (std::size_t i = 0; i < angles.size(); ++i) {
+        int16_t s = TrigImpl::sin(angles[i]);
+        int16_t c = TrigImpl::cos(angles[i]);
+        if (sin_out[i] != s || cos_out[i] != c || sin_pair[i] != s || cos_pair[i] != c) {
+            std::cout << "    Mismatch at angle " << angles[i]
+                      << ": batch sin=" << sin_out[i] << ", cos=" << cos_out[i]
+                      << ", scalar sin=" << s << ", cos=" << c << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+void test_batch() {
+    std::cout << "Testing batch sin/cos against scalar path...\n";
+    
+    // Every 16-bit angle, plus an odd length to exercise the scalar tail
+    std::vector<uint16_t> angles(65536 + 5);
+    for (std::size_t i = 0; i < angles.size(); ++i) {
+        angles[i] = static_cast<uint16_t>(i * 40503u);
+    }
+    
+    bool ok = batch_matches_scalar<Trig32>(angles) &&
+              batch_matches_scalar<Trig64>(angles) &&
+              batch_matches_scalar<Trig128>(angles) &&
+              batch_matches_scalar<Trig256>(angles) &&
+              batch_matches_scalar<Trig512>(angles) &&
+              batch_matches_scalar<IntegerTrig<8>>(angles);
+    assert(ok);
+    
+    // Output shorter than input: only the overlapping prefix is written
+    int16_t short_out[3] = {0, 0, 0};
+    Trig128::sin_batch(std::span<const uint16_t>(angles.data(), 10), std::span<int16_t>(short_out, 2));
+    assert(short_out[0] == Trig128::sin(angles[0]));
+    assert(short_out[1] == Trig128::sin(angles[1]));
+    assert(short_out[2] == 0);
+    
+    std::cout << "  ✓ Batch results are bit-exact\n\n";
+}
+
+// Largest sine error over every angle, in output LSB
+template<typename TrigImpl>
+double max_sine_error() {
+    double max_error = 0;
+    for (int angle = 0; angle < 16384; ++angle) {
+        double expected = 16384.0 * std::sin(2.0 * M_PI * angle / 16384.0);
+        max_error = std::max(max_error, std::abs(TrigImpl::sin(static_cast<uint16_t>(angle)) - expected));
+    }
+    return max_error;
+}
+
+// Test the sine interpolation policies
+void test_interpolation() {
+    std::cout << "Testing interpolation policies...\n";
+    
+    using Nearest128 = IntegerTrig<128, AtanDivide, InterpolateNearest>;
+    using Hermite8 = IntegerTrig<8, AtanDivide, InterpolateHermite>;
+    using Hermite16 = IntegerTrig<16, AtanDivide, InterpolateHermite>;
+    using Hermite128 = IntegerTrig<128, AtanDivide, InterpolateHermite>;
+    
+    double nearest = max_sine_error<Nearest128>();
+    double linear = max_sine_error<Trig128>();
+    double hermite8 = max_sine_error<Hermite8>();
+    double hermite16 = max_sine_error<Hermite16>();
+    std::cout << "  Nearest 128:  " << nearest << " LSB\n";
+    std::cout << "  Linear 128:   " << linear << " LSB\n";
+    std::cout << "  Hermite 8:    " << hermite8 << " LSB\n";
+    std::cout << "  Hermite 16:   " << hermite16 << " LSB\n";
+    
+    // Nearest: half a table step of slope 1, (π/2) / 127 / 2 · 16384
+    assert(nearest < 102.0);
+    // Hermite on a 16-entry table beats linear on 128 entries
+    assert(hermite8 < 2.0);
+    assert(hermite16 < 1.5);
+    assert(hermite16 < linear);
+    
+    // Exact at the cardinal angles
+    assert(Hermite8::sin(4096) == 16384 && Hermite8::sin(0) == 0 && Hermite8::cos(0) == 16384);
+    assert(Nearest128::sin(12288) == -16384);
+    
+    // Derivative table is the only extra memory
+    static_assert(Hermite128::table_memory() == Trig128::table_memory() + 128 * sizeof(int16_t));
+    static_assert(Nearest128::table_memory() == Trig128::table_memory());
+    
+    // Batch kernels follow the policy bit for bit
+    std::vector<uint16_t> angles(65536 + 5);
+    for (std::size_t i = 0; i < angles.size(); ++i) {
+        angles[i] = static_cast<uint16_t>(i * 40503u);
+    }
+    bool ok = batch_matches_scalar<Nearest128>(angles) &&
+              batch_matches_scalar<IntegerTrig<8, AtanDivide, InterpolateNearest>>(angles) &&
+              batch_matches_scalar<Hermite8>(angles) &&
+              batch_matches_scalar<Hermite16>(angles) &&
+              batch_matches_scalar<Hermite128>(angles) &&
+              batch_matches_scalar<IntegerTrig<4096, AtanDivide, InterpolateHermite>>(angles);
+    assert(ok);
+    
+    std::cout << "  ✓ Interpolation tests passed\n\n";
+}
+
+// Interleaved {value, delta} layout must reproduce the split layout exactly
+template<std::size_t TableSize>
+bool layouts_match() {
+    using Split = IntegerTrig<TableSize>;
+    using Interleaved = IntegerTrig<TableSize, AtanDivide, InterpolateLinear, LayoutInterleaved>;
+    for (uint32_t angle = 0; angle < 65536; ++angle) {
+        if (Split::sin(angle) != Interleaved::sin(angle) || Split::cos(angle) != Interleaved::cos(angle)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void test_layout() {
+    std::cout << "Testing interleaved table layout...\n";
+    
+    using Interleaved128 = IntegerTrig<128, AtanDivide, InterpolateLinear, LayoutInterleaved>;
+    
+    bool ok = layouts_match<8>() && layouts_match<128>() && layouts_match<4096>();
+    assert(ok);
+    
+    std::vector<uint16_t> angles(65536 + 5);
+    for (std::size_t i = 0; i < angles.size(); ++i) {
+        angles[i] = static_cast<uint16_t>(i * 40503u);
+    }
+    ok = batch_matches_scalar<Interleaved128>(angles) &&
+         batch_matches_scalar<IntegerTrig<8, AtanDivide, InterpolateLinear, LayoutInterleaved>>(angles);
+    assert(ok);
+    
+    // Sine table doubles in size; the inverse tables are unchanged
+    static_assert(Interleaved128::table_memory() == Trig128::table_memory() + 128 * sizeof(int16_t));
+    
+    std::cout << "  ✓ Layouts are bit-exact\n\n";
+}
+
+// Largest Q31 sine error in LSB over pseudo-random 32-bit angles
+template<typename TrigImpl>
+double max_sine_error_q31() {
+    double max_error = 0;
+    uint32_t angle = 1;
+    for (int k = 0; k < 200000; ++k) {
+        angle = angle * 1664525u + 1013904223u;
+        long double expected = std::sin(2.0L * M_PI * angle / 4294967296.0L) * 2147483648.0L;
+        max_error = std::max(max_error, double(std::abs(TrigImpl::sin(angle) - expected)));
+    }
+    return max_error;
+}
+
+// Test the 32-bit angle / Q31 variant
+void test_trig32() {
+    std::cout << "Testing IntegerTrig32 (Q31)...\n";
+    
+    double linear = max_sine_error_q31<TrigQ31>();
+    double hermite = max_sine_error_q31<TrigQ31Hermite>();
+    std::cout << std::scientific;
+    std::cout << "  TrigQ31 max error:        " << linear / 2147483648.0 << "\n";
+    std::cout << "  TrigQ31Hermite max error: " << hermite / 2147483648.0 << "\n";
+    std::cout << std::fixed;
+    assert(linear / 2147483648.0 < 4e-7);
+    assert(hermite / 2147483648.0 < 3e-9);
+    
+    // Cardinal angles and saturation of +1.0
+    static_assert(TrigQ31::sin(0) == 0);
+    static_assert(TrigQ31::sin(TrigQ31::QUARTER_TURN) == INT32_MAX);
+    static_assert(TrigQ31::sin(3u * TrigQ31::QUARTER_TURN) == -INT32_MAX);
+    static_assert(TrigQ31::cos(TrigQ31::HALF_TURN) == -INT32_MAX);
+    
+    // sincos and batches are bit-exact with the scalar calls
+    std::vector<uint32_t> angles(4099);
+    uint32_t seed = 99;
+    for (auto& a : angles) {
+        seed = seed * 1664525u + 1013904223u;
+        a = seed;
+    }
+    std::vector<int32_t> sin_out(angles.size()), cos_out(angles.size());
+    std::vector<int32_t> sin_pair(angles.size()), cos_pair(angles.size());
+    TrigQ31Hermite::sin_batch(angles, sin_out);
+    TrigQ31Hermite::cos_batch(angles, cos_out);
+    TrigQ31Hermite::sincos_batch(angles, sin_pair, cos_pair);
+    for (std::size_t i = 0; i < angles.size(); ++i) {
+        assert(sin_out[i] == TrigQ31Hermite::sin(angles[i]));
+        assert(cos_out[i] == TrigQ31Hermite::cos(angles[i]));
+        assert(sin_pair[i] == sin_out[i] && cos_pair[i] == cos_out[i]);
+    }
+    
+    // A 32-bit phase accumulator is an angle; 14-bit angles map exactly
+    for (int a = 0; a < 16384; a += 7) {
+        int32_t wide = TrigQ31Hermite::sin(TrigQ31::from_angle14(static_cast<uint16_t>(a)));
+        assert(std::abs((wide >> 17) - Trig512::sin(static_cast<uint16_t>(a))) <= 2);
+    }
+    
+    // atan2 over the full int32 range, including extreme inputs
+    double max_atan_error = 0;
+    for (int k = 0; k < 100000; ++k) {
+        seed = seed * 1664525u + 1013904223u;
+        int32_t x = static_cast<int32_t>(seed);
+        seed = seed * 1664525u + 1013904223u;
+        int32_t y = static_cast<int32_t>(seed) >> (k & 31);
+        long double expected = std::atan2((long double)y, (long double)x) / (2.0L * M_PI) * 4294967296.0L;
+        long double diff = (long double)TrigQ31::atan2(y, x) - expected;
+        diff -= 4294967296.0L * std::round(diff / 4294967296.0L);
+        max_atan_error = std::max(max_atan_error, double(std::abs(diff)));
+    }
+    std::cout << "  atan2 max error: " << max_atan_error << " units of 2^-32 turn\n";
+    assert(max_atan_error < 2.0);
+    assert(TrigQ31::atan2(0, 0) == 0);
+    assert(TrigQ31::atan2(1, 0) == TrigQ31::QUARTER_TURN);
+    assert(TrigQ31::atan2(0, -5) == TrigQ31::HALF_TURN);
+    assert(TrigQ31::atan2(INT32_MIN, INT32_MIN) == 5u * (TrigQ31::QUARTER_TURN >> 1));
+    
+    std::cout << "  ✓ IntegerTrig32 tests passed\n\n";
+}
+
+// Largest asin/acos error over every input, in angle units
+template<typename TrigImpl>
+double max_inverse_sine_error() {
+    double max_error = 0;
+    for (int v = -16384; v <= 16384; ++v) {
+        double asin_expected = std::asin(v / 16384.0) / (2.0 * M_PI) * 16384.0;
+        double acos_expected = std::acos(v / 16384.0) / (2.0 * M_PI) * 16384.0;
+        double asin_diff = TrigImpl::asin(static_cast<int16_t>(v)) - asin_expected;
+        double acos_diff = TrigImpl::acos(static_cast<int16_t>(v)) - acos_expected;
+        asin_diff -= 16384.0 * std::round(asin_diff / 16384.0);
+        acos_diff -= 16384.0 * std::round(acos_diff / 16384.0);
+        max_error = std::max({max_error, std::abs(asin_diff), std::abs(acos_diff)});
+    }
+    return max_error;
+}
+
+// Test the sine-table-only storage policy
+void test_memory_minimal() {
+    std::cout << "Testing MemoryMinimal storage...\n";
+    
+    static_assert(TrigMinimal<128>::table_memory() * 3 == Trig128::table_memory());
+    static_assert(TrigMinimal<32>::table_memory() == 64);
+    
+    // Forward functions use the same table and are bit-exact
+    for (int angle = 0; angle < 16384; ++angle) {
+        assert(TrigMinimal<128>::sin(angle) == Trig128::sin(angle));
+    }
+    
+    double asin_min = max_inverse_sine_error<TrigMinimal<128>>();
+    double asin_full = max_inverse_sine_error<Trig128>();
+    double atan_min = atan2_max_error<TrigMinimal<128>>();
+    std::cout << "  asin/acos error (units): minimal " << asin_min << ", full " << asin_full << "\n";
+    std::cout << "  atan2 error (units): minimal " << atan_min << "\n";
+    assert(asin_min < 1.5 && atan_min < 1.0);
+    assert(max_inverse_sine_error<TrigMinimal<8>>() < 20.0);
+    assert(max_inverse_sine_error<TrigMinimal<4096>>() < 1.5);
+    
+    // Every atan policy and layout combines with it
+    using Reciprocal = IntegerTrig<64, AtanReciprocal, InterpolateLinear, LayoutSplit, MemoryMinimal>;
+    using Interleaved = IntegerTrig<64, AtanCordic, InterpolateLinear, LayoutInterleaved, MemoryMinimal>;
+    assert(atan2_max_error<Reciprocal>() < 1.0);
+    assert(max_inverse_sine_error<Interleaved>() < 2.5);
+    
+    assert(TrigMinimal<128>::asin(16384) == 4096 && TrigMinimal<128>::asin(-16384) == 12288);
+    assert(TrigMinimal<128>::asin(0) == 0 && TrigMinimal<128>::acos(16384) == 0);
+    assert(TrigMinimal<128>::atan2(1000, 1000) == 2048);
+    
+    std::cout << "  ✓ MemoryMinimal tests passed\n\n";
+}
+
+// Test the direct 2-D atan2 table
+void test_atan2_lut() {
+    std::cout << "Testing atan2_lut...\n";
+    
+    // Every input within Bits bits is exact up to table rounding
+    double small_error = 0;
+    for (int y = -63; y <= 63; ++y) {
+        for (int x = -63; x <= 63; ++x) {
+            if (x == 0 && y == 0) continue;
+            double expected = std::atan2(double(y), double(x)) / (2.0 * M_PI) * 16384.0;
+            double diff = atan2_lut<6>(static_cast<int16_t>(y), static_cast<int16_t>(x)) - expected;
+            diff -= 16384.0 * std::round(diff / 16384.0);
+            small_error = std::max(small_error, std::abs(diff));
+        }
+    }
+    
+    // Full int16 range within the documented bound
+    double error6 = 0;
+    double error8 = 0;
+    for (int y = -32768; y < 32768; y += 61) {
+        for (int x = -32768; x < 32768; x += 67) {
+            if (x == 0 && y == 0) continue;
+            double expected = std::atan2(double(y), double(x)) / (2.0 * M_PI) * 16384.0;
+            double diff6 = atan2_lut<6>(static_cast<int16_t>(y), static_cast<int16_t>(x)) - expected;
+            double diff8 = atan2_lut<8>(static_cast<int16_t>(y), static_cast<int16_t>(x)) - expected;
+            diff6 -= 16384.0 * std::round(diff6 / 16384.0);
+            diff8 -= 16384.0 * std::round(diff8 / 16384.0);
+            error6 = std::max(error6, std::abs(diff6));
+            error8 = std::max(error8, std::abs(diff8));
+        }
+    }
+    std::cout << "  6-bit inputs: " << small_error << " units; int16: Bits=6 " << error6
+              << ", Bits=8 " << error8 << "\n";
+    assert(small_error <= 0.51);
+    assert(error6 <= 0.51 + 1574.0 / 32 && error8 <= 0.51 + 1574.0 / 128);
+    
+    // Axes, diagonals and the origin agree with IntegerTrig
+    const int16_t points[][2] = {{0, 0}, {1000, 0}, {0, 1000}, {-1000, 0}, {0, -1000},
+                                 {500, 500}, {-500, 500}, {-500, -500}, {500, -500}};
+    for (const auto& p : points) {
+        assert(atan2_lut<6>(p[0], p[1]) == Trig128::atan2(p[0], p[1]));
+    }
+    static_assert(atan2_lut_memory<6>() == 3234);
+    
+    std::cout << "  ✓ atan2_lut tests passed\n\n";
+}
+
+// Test the Fixed<> number type
+void test_fixed() {
+    std::cout << "Testing Fixed<> fixed point...\n";
+
+    using Coord = Fixed<15, 0, int16_t>;
+
+    // Formats, widening and constants
+    static_assert(sizeof(Q14) == 2 && sizeof(Q31) == 4);
+    static_assert(std::is_same_v<decltype(Q14() * Q14()), Fixed<3, 28>>);
+    static_assert(std::is_same_v<decltype(Coord() * Q14()), Fixed<17, 14>>);
+    static_assert(std::is_same_v<decltype(Q31() * Q31()), Fixed<1, 62>>);
+    static_assert(Q14(1.0).raw() == 16384 && Q14(-0.5).raw() == -8192);
+    static_assert(Q15(0.999969482421875).raw() == Q15::RAW_MAX);
+    static_assert(std::is_convertible_v<Fixed<0, 14, int16_t>, Q15> && !std::is_convertible_v<Q14, Q15>);
+    static_assert(!std::is_convertible_v<Fixed<3, 28>, Q14>);
+    static_assert(Fixed<3, 28>(Q14(0.25)).raw() == (1 << 26));
+
+    // Rounding matches the shifts and division it replaces
+    for (int raw = -70000; raw <= 70000; raw += 7) {
+        auto value = Fixed<5, 14>::from_raw(raw);
+        assert((fixed_cast<Fixed<5, 0>>(value).raw() == (raw >> 14)));
+        assert((fixed_cast<Fixed<5, 0>, RoundToZero>(value).raw() == raw / 16384));
+        assert((fixed_cast<Fixed<5, 0>, RoundNearest>(value).raw() == (raw + 8192) >> 14));
+        assert(value.to_int<RoundNearest>() == std::floor(raw / 16384.0 + 0.5));
+    }
+
+    // Products equal the hand-written multiply and shift
+    for (int a = -32768; a < 32768; a += 251) {
+        for (int b = -16384; b <= 16384; b += 97) {
+            auto product = Coord(a) * Q14::from_raw(static_cast<int16_t>(b));
+            assert(product.raw() == a * b);
+            assert(fixed_cast<Coord>(product).raw() == static_cast<int16_t>((a * b) >> 14));
+        }
+    }
+
+    // Saturation
+    assert(saturate_cast<Q14>(Q14(1.5) * Q14(1.5)) == Q14::from_raw(Q14::RAW_MAX));
+    assert(saturate_cast<Q14>(Q14(-1.5) * Q14(1.5)) == Q14::from_raw(Q14::RAW_MIN));
+    assert(saturate_cast<Q14>(Q14(0.5) * Q14(-0.5)) == Q14(-0.25));
+    assert(saturate_cast<Q15>(Q14(1.25)) == Q15::from_raw(Q15::RAW_MAX));
+    assert(saturate_cast<Q15>(Q14(-1.25)) == Q15::from_raw(Q15::RAW_MIN));
+    assert(saturate_cast<Q15>(Q14(-0.75)) == Q15(-0.75));
+    
+    // Equal integer bits, all-ones fraction: the rounding carry clamps
+    using Q1_13 = Fixed<1, 13>;
+    using Q1_15_32 = Fixed<1, 15, int32_t>;
+    assert((saturate_cast<Q1_13, RoundNearest>(Q14::from_raw(32767)) == Q1_13::from_raw(Q1_13::RAW_MAX)));
+    assert((saturate_cast<Q1_13, RoundNearest>(Q14::from_raw(-32768)) == Q1_13::from_raw(-16384)));
+    assert((saturate_cast<Q14, RoundNearest>(Q1_15_32::from_raw(65535)) == Q14::from_raw(Q14::RAW_MAX)));
+    assert((saturate_cast<Q14, RoundNearest>(Q1_15_32::from_raw(-65535)) == Q14::from_raw(-32767)));
+    assert((saturate_cast<Q14, RoundNearest>(Q1_15_32::from_raw(65532)) == Q14::from_raw(32766)));
+    assert(add_sat(Q14(1.5), Q14(1.0)) == Q14::from_raw(Q14::RAW_MAX));
+    assert(sub_sat(Q14(-1.5), Q14(1.0)) == Q14::from_raw(Q14::RAW_MIN));
+    assert(add_sat(Q14(0.5), Q14(-1.0)) == Q14(-0.5));
+    assert(Q14(0.5) + Q14(0.25) > Q14(0.5) && -Q14(0.5) == Q14(-0.5));
+
+    // Trig results carry the same bits as the integer versions
+    for (int angle = 0; angle < 16384; angle += 3) {
+        Q14 s, c;
+        Trig128::sincos(static_cast<uint16_t>(angle), s, c);
+        assert(s.raw() == Trig128::sin(angle) && c.raw() == Trig128::cos(angle));
+        assert(Trig128::sin_fixed(angle) == s && PolyTrig<5>::cos_fixed(angle).raw() == PolyTrig<5>::cos(angle));
+    }
+    for (uint32_t angle = 0; angle < 0xFFF00000u; angle += 0x00F0F0F1u) {
+        assert(TrigQ31::sin_fixed(angle).raw() == TrigQ31::sin(angle));
+    }
+
+    std::cout << "  ✓ Fixed<> tests passed\n\n";
+}
+
+// Test typed angles and unit conversion
+void test_angle() {
+    std::cout << "Testing typed angles...\n";
+
+    // Unit conversion folds at compile time
+    static_assert(Angle14(45_deg).raw() == 2048 && Angle14(-90_deg).raw() == 12288);
+    static_assert(Angle16(360_deg).raw() == 0 && Angle32(90_deg).raw() == 0x40000000u);
+    static_assert(Angle14(3142_mrad).raw() == 8193 && Angle14(-1571_mrad).raw() == 12287);
+    static_assert(Angle16(Angle14::from_raw(1)).raw() == 4);
+    static_assert(angle_cast<Angle14, RoundNearest>(Angle16::from_raw(65535)).raw() == 0);
+    static_assert(angle_cast<Angle14>(Angle16::from_raw(65535)).raw() == 16383);
+    static_assert((Angle14(350_deg) + Angle14(20_deg)).raw() == Angle14(10_deg).raw());
+    static_assert(Angle16::from_raw(0xC000).to_signed() == -16384);
+    static_assert(Angle32(-1_deg).to_degrees().value == 359);
+    static_assert(Trig128::sin(90_deg) == 16384 && Trig128::cos(Angle14(180_deg)) == -16384);
+
+    // Mismatched units do not convert
+    static_assert(!std::is_convertible_v<Angle16, Angle14>);
+    static_assert(!std::is_convertible_v<int, Angle14> && !std::is_convertible_v<int, Degrees>);
+
+    // Conversion within 0.75 unit of exact over the whole int32 range
+    double degree_error = 0;
+    double mrad_error = 0;
+    for (int64_t value = INT32_MIN; value <= INT32_MAX; value += 65521) {
+        double exact_deg = std::fmod(double(value) / 360.0 * 16384.0, 16384.0);
+        double exact_mrad = std::fmod(double(value) / (2000.0 * M_PI) * 16384.0, 16384.0);
+        double deg = Angle14(Degrees(static_cast<int32_t>(value))).raw() - exact_deg;
+        double mrad = Angle14(Milliradians(static_cast<int32_t>(value))).raw() - exact_mrad;
+        degree_error = std::max(degree_error, std::abs(deg - 16384.0 * std::round(deg / 16384.0)));
+        mrad_error = std::max(mrad_error, std::abs(mrad - 16384.0 * std::round(mrad / 16384.0)));
+    }
+    std::cout << "  Conversion error (units): degrees " << degree_error
+              << ", milliradians " << mrad_error << "\n";
+    assert(degree_error <= 0.75 && mrad_error <= 0.75);
+
+    // Typed overloads agree with the raw ones
+    for (int deg = -720; deg <= 720; deg += 7) {
+        Angle14 angle = Degrees(deg);
+        assert(Trig128::sin(angle) == Trig128::sin(angle.raw()));
+        assert(AngleConvert::from_degrees(static_cast<int16_t>(deg)) == angle.raw());
+        assert(angle.to_degrees().value == ((deg % 360) + 360) % 360);
+        assert(TrigQ31::sin(Angle32(angle)) == TrigQ31::sin(IntegerTrig32<>::from_angle14(angle.raw())));
+    }
+    assert(Trig128::atan2<16>(1000, 1000).raw() == 8192);
+    assert(Trig128::atan2<14>(-1000, 0) == Angle14(270_deg));
+    assert(TrigQ31::atan2<16>(0, -1000) == Angle16(180_deg));
+
+    std::cout << "  ✓ Typed angle tests passed\n\n";
+}
+
+// Test the cached rotor
+void test_rotor() {
+    std::cout << "Testing Rotor...\n";
+
+    using V = Vector2D<Trig128>;
+    using R = Rotor<Trig128>;
+
+    // Batch rotation is bit-exact with Vector2D::rotate, both layouts,
+    // including corners that wrap and lengths that leave the SIMD blocks
+    std::vector<V::Vec2> points(1003);
+    uint32_t seed = 77;
+    for (auto& p : points) {
+        seed = seed * 1664525u + 1013904223u;
+        p = {static_cast<int16_t>(seed >> 16), static_cast<int16_t>(seed)};
+    }
+    points[0] = {-32768, -32768};
+    points[1] = {32767, -32768};
+    std::vector<int16_t> xs(points.size()), ys(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        xs[i] = points[i].x;
+        ys[i] = points[i].y;
+    }
+
+    for (int angle = 0; angle < 16384; angle += 97) {
+        R rotor(Angle14::from_raw(angle));
+        std::vector<V::Vec2> aos = points;
+        std::vector<int16_t> x_out(xs.size()), y_out(ys.size());
+        rotor.apply(aos, aos);
+        rotor.apply(xs, ys, x_out, y_out);
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            V::Vec2 expected = V::rotate(points[i], static_cast<uint16_t>(angle));
+            assert(aos[i].x == expected.x && aos[i].y == expected.y);
+            assert(x_out[i] == expected.x && y_out[i] == expected.y);
+        }
+    }
+
+    // Composition and inverse
+    int compose_error = 0;
+    for (int a = 0; a < 16384; a += 211) {
+        for (int b = 0; b < 16384; b += 223) {
+            R composed = R(Angle14::from_raw(a)) * R(Angle14::from_raw(b));
+            R direct(Angle14::from_raw(a + b));
+            compose_error = std::max({compose_error, std::abs(composed.sin().raw() - direct.sin().raw()),
+                                      std::abs(composed.cos().raw() - direct.cos().raw())});
+        }
+    }
+    std::cout << "  Composition vs direct lookup: " << compose_error << " LSB\n";
+    assert(compose_error <= 6);
+
+    R forward(30_deg);
+    R round_trip = forward * forward.inverse();
+    assert(std::abs(round_trip.cos().raw() - 16384) <= 5 && round_trip.sin().raw() == 0);
+
+    // A long chain drifts in length; renormalize() pulls it back
+    R step(Angle14::from_raw(7)), chain, renormalized;
+    for (int k = 1; k <= 4096; ++k) {
+        chain *= step;
+        renormalized *= step;
+        if (k % 64 == 0) renormalized = renormalized.renormalize();
+    }
+    auto length = [](R r) { return std::hypot(r.sin().raw(), r.cos().raw()) / 16384.0; };
+    std::cout << "  Length after 4096 compositions: " << length(chain)
+              << ", renormalized every 64: " << length(renormalized) << "\n";
+    assert(std::abs(length(renormalized) - 1.0) < 0.005);
+    assert(std::abs(length(R::from_sincos(Q14(0.606), Q14(0.808)).renormalize()) - 1.0) < 0.0005);
+
+    std::cout << "  ✓ Rotor tests passed\n\n";
+}
+
+// SoA batches agree with the single-point Vector2D functions
+template<typename TrigImpl>
+bool vector_batch_matches() {
+    using V = Vector2D<TrigImpl>;
+    static typename V::template Vec2Array<1024> points, back, moved;
+    static typename V::template PolarArray<1024> polar;
+
+    // Odd count so the SIMD blocks leave a scalar tail
+    points.count = 1001;
+    uint32_t seed = 31;
+    for (std::size_t i = 0; i < points.count; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        points.x[i] = static_cast<int16_t>(seed >> 16);
+        points.y[i] = static_cast<int16_t>(seed);
+    }
+    const int16_t corners[][2] = {{0, 0}, {-32768, -32768}, {-32768, 0}, {0, -32768}, {1, -1}, {32767, 32767}};
+    for (std::size_t k = 0; k < std::size(corners); ++k) {
+        points.x[k * 7] = corners[k][0];
+        points.y[k * 7] = corners[k][1];
+    }
+
+    V::to_polar(points, polar);
+    V::from_polar(polar, back);
+    moved = points;
+    V::rotate(moved.xs(), moved.ys(), 5000, moved.xs(), moved.ys());
+    V::translate(moved.xs(), moved.ys(), {-300, 32000}, moved.xs(), moved.ys());
+
+    for (std::size_t i = 0; i < points.count; ++i) {
+        typename V::Polar p = V::to_polar({points.x[i], points.y[i]});
+        typename V::Vec2 c = V::from_polar(p);
+        typename V::Vec2 r = V::rotate({points.x[i], points.y[i]}, 5000);
+        if (polar.angle[i] != p.angle || polar.magnitude[i] != p.magnitude ||
+            back.x[i] != c.x || back.y[i] != c.y ||
+            moved.x[i] != static_cast<int16_t>(r.x - 300) || moved.y[i] != static_cast<int16_t>(r.y + 32000)) {
+            return false;
+        }
+    }
+    return back.count == points.count;
+}
+
+void test_vector_batch() {
+    std::cout << "Testing Vector2D SoA batches...\n";
+
+    assert(vector_batch_matches<Trig128>());
+    assert((vector_batch_matches<IntegerTrig<64, AtanCordic>>()));
+    assert(vector_batch_matches<PolyTrig<5>>());
+
+    // IntegerTrig::to_polar_batch directly, full int16 grid
+    std::vector<int16_t> xs, ys;
+    for (int y = -32768; y < 32768; y += 251) {
+        for (int x = -32768; x < 32768; x += 257) {
+            xs.push_back(static_cast<int16_t>(x));
+            ys.push_back(static_cast<int16_t>(y));
+        }
+    }
+    std::vector<uint16_t> angles(xs.size());
+    std::vector<int32_t> magnitudes(xs.size());
+    Trig128::to_polar_batch(xs, ys, angles, magnitudes);
+    for (std::size_t i = 0; i < xs.size(); ++i) {
+        auto p = Trig128::to_polar(xs[i], ys[i]);
+        assert(angles[i] == p.angle && magnitudes[i] == p.magnitude);
+    }
+
+    std::cout << "  ✓ Vector2D batch tests passed\n\n";
+}
+
+// Test 3-D rotations against a double-precision reference
+void test_rotation3d() {
+    std::cout << "Testing 3-D rotations...\n";
+
+    // Integer inverse square root, across exponents
+    double isqrt_error = 0;
+    for (uint64_t v = 1; v < (uint64_t(1) << 50); v = v * 3 / 2 + 1) {
+        for (int frac_bits : {0, 28, 30, 60}) {
+            double x = std::ldexp(double(v), -frac_bits);
+            double expected = std::ldexp(1.0 / std::sqrt(x), 30);
+            if (expected < (1 << 20)) continue;
+            double got = double(detail::inverse_sqrt_q30(v, frac_bits));
+            isqrt_error = std::max(isqrt_error, std::abs(got - expected) / expected);
+        }
+    }
+    std::cout << "  inverse_sqrt_q30 relative error: " << std::scientific << isqrt_error << std::fixed << "\n";
+    assert(isqrt_error < 1e-6);
+
+    using V = Vector3D;
+    assert((V::normalize({3, 4, 0}) == V::Vec3{9830, 13107, 0}));
+    assert((V::normalize({-32768, -32768, -32768}) == V::Vec3{-9459, -9459, -9459}));
+    assert(V::magnitude({2, 3, 6}) == 7);
+    auto c = V::cross({-32768, 0, 0}, {0, -32768, 0});
+    assert(c.x == 0 && c.y == 0 && c.z == 1073741824);
+
+    // Euler -> quaternion and matrix, |pitch| below 66°
+    double quat_error = 0, matrix_error = 0, via_quat_error = 0;
+    int round_trip_error = 0;
+    uint32_t seed = 5;
+    auto next = [&seed] { seed = seed * 1664525u + 1013904223u; return seed >> 8; };
+    for (int i = 0; i < 5000; ++i) {
+        EulerAngles e{Angle14::from_raw(next()), Angle14::from_raw(uint32_t(int(next() % 6000) - 3000)),
+                      Angle14::from_raw(next())};
+        double r = e.roll.to_signed() * M_PI / 8192;
+        double p = e.pitch.to_signed() * M_PI / 8192;
+        double y = e.yaw.to_signed() * M_PI / 8192;
+
+        double cr = std::cos(r / 2), sr = std::sin(r / 2), cp = std::cos(p / 2);
+        double sp = std::sin(p / 2), cy = std::cos(y / 2), sy = std::sin(y / 2);
+        double expected[4] = {cr * cp * cy + sr * sp * sy, sr * cp * cy - cr * sp * sy,
+                              cr * sp * cy + sr * cp * sy, cr * cp * sy - sr * sp * cy};
+        auto q = Quaternion<30>::from_euler(e);
+        double got[4] = {q.w.raw() / 1073741824.0, q.x.raw() / 1073741824.0,
+                         q.y.raw() / 1073741824.0, q.z.raw() / 1073741824.0};
+        double same = 0, flipped = 0;   // q and -q are the same rotation
+        for (int k = 0; k < 4; ++k) {
+            same = std::max(same, std::abs(got[k] - expected[k]));
+            flipped = std::max(flipped, std::abs(got[k] + expected[k]));
+        }
+        quat_error = std::max(quat_error, std::min(same, flipped) * 16384);
+
+        double m[9] = {std::cos(y) * std::cos(p),
+                       std::cos(y) * std::sin(p) * std::sin(r) - std::sin(y) * std::cos(r),
+                       std::cos(y) * std::sin(p) * std::cos(r) + std::sin(y) * std::sin(r),
+                       std::sin(y) * std::cos(p),
+                       std::sin(y) * std::sin(p) * std::sin(r) + std::cos(y) * std::cos(r),
+                       std::sin(y) * std::sin(p) * std::cos(r) - std::cos(y) * std::sin(r),
+                       -std::sin(p), std::cos(p) * std::sin(r), std::cos(p) * std::cos(r)};
+        Rot3 direct = Rot3::from_euler(e);
+        Rot3 via_quat = Rot3::from_quaternion(q);
+        for (int k = 0; k < 9; ++k) {
+            matrix_error = std::max(matrix_error, std::abs(direct.m[k].raw() - m[k] * 16384));
+            via_quat_error = std::max(via_quat_error, std::abs(via_quat.m[k].raw() - m[k] * 16384));
+        }
+
+        EulerAngles back = Quaternion<14>::from_euler(e).to_euler();
+        round_trip_error = std::max({round_trip_error, std::abs((back.roll - e.roll).to_signed()),
+                                     std::abs((back.pitch - e.pitch).to_signed()),
+                                     std::abs((back.yaw - e.yaw).to_signed())});
+    }
+    std::cout << "  Quaternion<30>::from_euler: " << quat_error << " LSB (Q14)\n";
+    std::cout << "  Rot3 from Euler / from quaternion: " << matrix_error << " / " << via_quat_error << " LSB\n";
+    std::cout << "  Euler round trip: " << round_trip_error << " units\n";
+    assert(quat_error < 3 && matrix_error < 5 && via_quat_error < 6);
+    assert(round_trip_error <= 2);
+
+    // Composition, inverse and normalisation
+    using Quat = Quaternion<30>;
+    auto yaw = [](int raw) { return Quat::from_euler(EulerAngles{{}, {}, Angle14::from_raw(raw)}); };
+    for (int a = 0; a < 16384; a += 1021) {
+        Quat composed = yaw(a) * yaw(5000);
+        Quat direct = yaw(a + 5000);
+        int64_t sign = (int64_t(composed.w.raw()) * direct.w.raw() + int64_t(composed.z.raw()) * direct.z.raw() < 0) ? -1 : 1;
+        assert(std::abs(composed.w.raw() - sign * direct.w.raw()) < (4 << 16));
+        assert(std::abs(composed.z.raw() - sign * direct.z.raw()) < (4 << 16));
+    }
+
+    Quat q = Quat::from_euler(EulerAngles{Angle14::from_raw(1000), Angle14::from_raw(2000), Angle14::from_raw(3000)});
+    Quat identity = q * q.conjugate();
+    assert(std::abs(identity.w.raw() - (1 << 30)) < 1024 && identity.x.raw() == 0);
+    Quat::Component grow = 1.01;
+    Quat scaled{fixed_cast<Quat::Component>(q.w * grow), fixed_cast<Quat::Component>(q.x * grow),
+                fixed_cast<Quat::Component>(q.y * grow), fixed_cast<Quat::Component>(q.z * grow)};
+    Quat renormalized = scaled.normalized();
+    double norm_sq = 0;
+    for (auto component : {renormalized.w, renormalized.x, renormalized.y, renormalized.z}) {
+        norm_sq += std::pow(component.raw() / 1073741824.0, 2);
+    }
+    assert(std::abs(norm_sq - 1) < 1e-8);
+
+    // Batches match the single-vector path; the transpose undoes the rotation
+    Rot3 rotation = Rot3::from_quaternion(q);
+    std::vector<V::Vec3> points(999);
+    std::vector<int16_t> xs(points.size()), ys(points.size()), zs(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        points[i] = {static_cast<int16_t>(int(next() % 40000) - 20000), static_cast<int16_t>(int(next() % 40000) - 20000),
+                     static_cast<int16_t>(int(next() % 40000) - 20000)};
+        xs[i] = points[i].x;
+        ys[i] = points[i].y;
+        zs[i] = points[i].z;
+    }
+    std::vector<V::Vec3> rotated(points.size());
+    rotation.apply(points, rotated);
+    rotation.apply(xs, ys, zs, xs, ys, zs);
+    Rot3 inverse = rotation.transpose();
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        assert(rotated[i] == rotation.apply(points[i]));
+        assert((rotated[i] == V::Vec3{xs[i], ys[i], zs[i]}));
+        V::Vec3 back = inverse.apply(rotated[i]);
+        assert(std::abs(back.x - points[i].x) <= 8 && std::abs(back.y - points[i].y) <= 8 &&
+               std::abs(back.z - points[i].z) <= 8);
+    }
+
+    std::cout << "  ✓ 3-D rotation tests passed\n\n";
+}
+
+// Test the fused FOC step against a double-precision reference
+void test_foc() {
+    std::cout << "Testing FOC...\n";
+
+    using Foc = FOC<Trig128>;
+    assert((Foc::clarke({1000, -500}) == AlphaBeta{1000, 0}));
+    assert((Foc::clarke({0, 1000}) == AlphaBeta{0, 1155}));
+    assert((Foc::clarke({-32768, -32768}) == AlphaBeta{-32768, -32768}));   // saturates
+
+    const uint16_t period = 4000;
+    Foc foc(period);
+    assert((foc.svpwm({0, 0}) == PwmDuty{2000, 2000, 2000}));
+    PwmDuty clipped = foc.svpwm({-32768, 32767});
+    assert(clipped.a <= period && clipped.b <= period && clipped.c <= period);
+
+    // Balanced currents up to 20000 and voltage vectors inside the linear
+    // range; line voltages are compared in timer counts
+    const double vdc = 32768.0 * std::sqrt(3.0);
+    double current_error = 0, voltage_error = 0;
+    std::vector<PhaseCurrents> currents;
+    std::vector<Angle14> angles;
+    std::vector<DQ> voltages;
+    uint32_t seed = 3;
+    auto next = [&seed] { seed = seed * 1664525u + 1013904223u; return seed >> 8; };
+    for (int n = 0; n < 20000; ++n) {
+        double amplitude = next() % 20000, phase = (next() % 16384) * 2 * M_PI / 16384;
+        PhaseCurrents i{static_cast<int16_t>(std::lround(amplitude * std::cos(phase))),
+                        static_cast<int16_t>(std::lround(amplitude * std::cos(phase - 2 * M_PI / 3)))};
+        double length = next() % 32000, direction = (next() % 16384) * 2 * M_PI / 16384;
+        DQ v{static_cast<int16_t>(length * std::cos(direction)), static_cast<int16_t>(length * std::sin(direction))};
+        Angle14 theta = Angle14::from_raw(next());
+        Foc::Cycle cycle = foc.run(i, theta, v);
+
+        double t = theta.raw() * 2 * M_PI / 16384;
+        double alpha = i.a, beta = (i.a + 2.0 * i.b) / std::sqrt(3.0);
+        current_error = std::max({current_error,
+                                  std::abs(cycle.current.d - (alpha * std::cos(t) + beta * std::sin(t))),
+                                  std::abs(cycle.current.q - (beta * std::cos(t) - alpha * std::sin(t)))});
+
+        double v_alpha = v.d * std::cos(t) - v.q * std::sin(t);
+        double v_beta = v.d * std::sin(t) + v.q * std::cos(t);
+        double ab = (cycle.duty.a - double(cycle.duty.b)) * vdc / period;
+        double bc = (cycle.duty.b - double(cycle.duty.c)) * vdc / period;
+        voltage_error = std::max({voltage_error, std::abs(ab - (1.5 * v_alpha - std::sqrt(3.0) / 2 * v_beta)) / (vdc / period),
+                                  std::abs(bc - std::sqrt(3.0) * v_beta) / (vdc / period)});
+
+        // The controller form sees the same current and gives the same duties
+        Foc::Cycle controlled = foc.run(i, theta, [&](DQ measured) {
+            assert(measured == cycle.current);
+            return v;
+        });
+        assert(controlled.current == cycle.current && controlled.duty == cycle.duty);
+
+        currents.push_back(i);
+        angles.push_back(theta);
+        voltages.push_back(v);
+    }
+    std::cout << "  Park current error: " << current_error << ", line voltage error: "
+              << voltage_error << " counts\n";
+    assert(current_error < 4);
+    assert(voltage_error < 2);
+
+    std::vector<Foc::Cycle> batch(currents.size());
+    foc.run(currents, angles, voltages, batch);
+    for (std::size_t n = 0; n < batch.size(); ++n) {
+        Foc::Cycle single = foc.run(currents[n], angles[n], voltages[n]);
+        assert(batch[n].current == single.current && batch[n].duty == single.duty);
+    }
+
+    std::cout << "  ✓ FOC tests passed\n\n";
+}
+
+// Test the angle tracking observer on simulated resolver samples
+void test_tracking_observer() {
+    std::cout << "Testing TrackingObserver...\n";
+
+    const int amplitude = 12000;
+    const double sample_rate = 20000;
+    auto sample = [&](double turns, double noise, int16_t& s, int16_t& c) {
+        s = static_cast<int16_t>(std::lround(amplitude * std::sin(2 * M_PI * turns) + noise));
+        c = static_cast<int16_t>(std::lround(amplitude * std::cos(2 * M_PI * turns) - noise));
+    };
+    auto angle_error = [](Angle14 estimate, double turns) {
+        return std::remainder(estimate.raw() - turns * 16384, 16384.0);
+    };
+
+    // Clean signal at constant speed: no lag, speed to within a few rpm.
+    // The first run starts a third of a turn off, without acquire()
+    for (double rpm : {3000.0, -1200.0, 0.0}) {
+        TrackingObserver<Trig128> observer(300, 20000, amplitude);
+        double turns = 0.3;
+        int16_t s, c;
+        if (rpm != 3000.0) {
+            sample(turns, 0, s, c);
+            observer.acquire(s, c);
+        }
+        double worst = 0;
+        for (int k = 0; k < 4000; ++k) {
+            turns += rpm / 60 / sample_rate;
+            sample(turns, 0, s, c);
+            Angle14 estimate = observer.update(s, c);
+            if (k >= 2000) worst = std::max(worst, std::abs(angle_error(estimate, turns)));
+        }
+        std::cout << "  " << rpm << " rpm: angle error " << worst << " units, speed "
+                  << observer.velocity_rpm(20000) << " rpm\n";
+        assert(worst <= 2);
+        assert(std::abs(observer.velocity_rpm(20000) - rpm) <= 10);
+    }
+
+    // Noisy signal: quieter than atan2 per sample, and batch matches single
+    const std::size_t count = 20000;
+    std::vector<int16_t> sines(count), cosines(count);
+    std::vector<double> truth(count);
+    uint32_t seed = 9;
+    double turns = 0.1;
+    for (std::size_t k = 0; k < count; ++k) {
+        seed = seed * 1664525u + 1013904223u;
+        double noise = (double(seed >> 16) / 65536.0 - 0.5) * 200;   // ±100 counts
+        turns += 1500.0 / 60 / sample_rate;
+        truth[k] = turns;
+        sample(turns, noise, sines[k], cosines[k]);
+    }
+    TrackingObserver<Trig128> single(300, 20000, amplitude), batch(300, 20000, amplitude);
+    single.acquire(sines[0], cosines[0]);
+    batch.acquire(sines[0], cosines[0]);
+    std::vector<Angle14> angles(count);
+    std::vector<int32_t> velocities(count);
+    batch.update(sines, cosines, angles, velocities);
+    double observer_sq = 0, atan2_sq = 0;
+    for (std::size_t k = 0; k < count; ++k) {
+        Angle14 estimate = single.update(sines[k], cosines[k]);
+        assert(estimate == angles[k] && single.velocity() == velocities[k]);
+        if (k >= 2000) {
+            observer_sq += std::pow(angle_error(estimate, truth[k]), 2);
+            atan2_sq += std::pow(angle_error(Angle14::from_raw(Trig128::atan2(sines[k], cosines[k])), truth[k]), 2);
+        }
+    }
+    double observer_rms = std::sqrt(observer_sq / (count - 2000));
+    double atan2_rms = std::sqrt(atan2_sq / (count - 2000));
+    std::cout << "  Noisy: observer rms " << observer_rms << " units, atan2 rms " << atan2_rms << "\n";
+    assert(observer_rms < atan2_rms / 2);
+    
+    // Pull-in from an offset angle, then a speed step: the gains bring
+    // the estimate onto the signal and the speed follows the step
+    TrackingObserver<Trig128> stepped(300, 20000, amplitude);
+    stepped.reset(Angle32::from_raw(0x20000000));   // 45° off a still signal at 0
+    double step_turns = 0;
+    int16_t step_s, step_c;
+    for (int k = 0; k < 1000; ++k) {
+        sample(step_turns, 0, step_s, step_c);
+        stepped.update(step_s, step_c);
+    }
+    std::cout << "  Pull-in from 45°: angle error " << angle_error(stepped.angle(), step_turns)
+              << " units, speed " << stepped.velocity_rpm(20000) << " rpm\n";
+    assert(std::abs(angle_error(stepped.angle(), step_turns)) <= 2);
+    assert(std::abs(stepped.velocity_rpm(20000)) <= 10);
+    double step_worst = 0;
+    for (int k = 0; k < 4000; ++k) {
+        step_turns += 2400.0 / 60 / sample_rate;
+        sample(step_turns, 0, step_s, step_c);
+        Angle14 estimate = stepped.update(step_s, step_c);
+        if (k >= 2000) step_worst = std::max(step_worst, std::abs(angle_error(estimate, step_turns)));
+    }
+    std::cout << "  Step to 2400 rpm: angle error " << step_worst << " units, speed "
+              << stepped.velocity_rpm(20000) << " rpm\n";
+    assert(step_worst <= 2);
+    assert(std::abs(stepped.velocity_rpm(20000) - 2400) <= 10);
+    
+    // A zero amplitude is taken as 1 instead of dividing by zero; a
+    // locked loop stays locked
+    TrackingObserver<Trig128> unit_amplitude(10, 20000, 0);
+    unit_amplitude.reset(Angle32::from_raw(0x40000000));
+    for (int k = 0; k < 100; ++k) {
+        assert(unit_amplitude.update(1, 0) == Angle14::from_raw(4096));
+    }
+    assert(unit_amplitude.velocity() == 0);
+
+    std::cout << "  ✓ TrackingObserver tests passed\n\n";
+}
+
+// Test differential-drive odometry against closed forms and a double
+// exact-arc integration
+void test_odometry() {
+    std::cout << "Testing Odometry...\n";
+
+    using Odo = Odometry<>;
+    const Odo::Length tick = 0.0625, track = 250.0;
+    auto mm = [](Odo::Position p) { return p.raw() / 4294967296.0; };
+    auto radians = [](Angle32 a) { return std::remainder(a.raw() * (2 * M_PI) / 4294967296.0, 2 * M_PI); };
+
+    // Straight: 100 m of equal ticks lands exactly
+    Odo straight(tick, track);
+    for (int k = 0; k < 100000; ++k) straight.update(16, 16);
+    assert(straight.x() == Odo::Position(100000) && straight.y() == Odo::Position(0));
+    assert(straight.heading().raw() == 0);
+
+    // Spin in place: no translation, heading from the tick count
+    Odo spin(tick, track);
+    spin.reset(Odo::Position(5), Odo::Position(-7), Angle32::from_raw(uint32_t(1) << 30));
+    for (int k = 0; k < 5000; ++k) spin.update(-10, 10);   // 0.005 rad each
+    double spin_error = std::remainder(radians(spin.heading()) - (M_PI / 2 + 25.0), 2 * M_PI);
+    std::cout << "  Spin: heading error " << spin_error * 1e6 << " µrad, drift "
+              << std::hypot(mm(spin.x()) - 5, mm(spin.y()) + 7) * 1000 << " µm\n";
+    assert(std::abs(spin_error) < 1e-8);
+    assert(std::hypot(mm(spin.x()) - 5, mm(spin.y()) + 7) < 1e-6);
+
+    // Ten laps of a 500 mm circle come back to the start
+    Odo circle(tick, track);
+    const int lap = 6283;   // 0.001 rad per sample
+    for (int k = 0; k < 10 * lap; ++k) circle.update(6, 10);
+    double lap_angle = 10 * lap * 0.001;
+    double expected_x = 500 * std::sin(lap_angle), expected_y = 500 * (1 - std::cos(lap_angle));
+    double circle_error = std::hypot(mm(circle.x()) - expected_x, mm(circle.y()) - expected_y);
+    std::cout << "  Circle: error " << circle_error * 1000 << " µm after 10 laps\n";
+    assert(circle_error < 1e-4);
+
+    // Wandering drive against double; batch matches single and the path
+    const std::size_t count = 200000;
+    std::vector<int32_t> left(count), right(count);
+    uint32_t seed = 17;
+    int turn = 0;
+    for (std::size_t k = 0; k < count; ++k) {
+        seed = seed * 1664525u + 1013904223u;
+        if (k % 500 == 0) turn = int(seed >> 24) % 41 - 20;
+        left[k] = 30 - turn + int(seed >> 8) % 5 - 2;
+        right[k] = 30 + turn + int(seed >> 16) % 5 - 2;
+    }
+    Odo single(tick, track), batch(tick, track);
+    std::vector<Odo::Pose> path(count);
+    batch.update(left, right, path);
+    double x = 0, y = 0, worst = 0;
+    int64_t difference = 0;
+    for (std::size_t k = 0; k < count; ++k) {
+        double theta = difference * 0.0625 / 250, turn_angle = (right[k] - left[k]) * 0.0625 / 250;
+        double arc = (left[k] + right[k]) * 0.0625 / 2;
+        double chord = turn_angle == 0 ? arc : arc * std::sin(turn_angle / 2) / (turn_angle / 2);
+        x += chord * std::cos(theta + turn_angle / 2);
+        y += chord * std::sin(theta + turn_angle / 2);
+        difference += right[k] - left[k];
+        single.update(left[k], right[k]);
+        assert(single.pose() == path[k]);
+        worst = std::max(worst, std::hypot(mm(single.x()) - x, mm(single.y()) - y));
+    }
+    double heading_error = std::remainder(radians(single.heading()) - difference * 0.0625 / 250, 2 * M_PI);
+    std::cout << "  Random drive: " << x / 1000 << ", " << y / 1000 << " m, worst error " << worst * 1000
+              << " µm, heading error " << heading_error * 1e6 << " µrad\n";
+    assert(worst < 0.001);
+    assert(std::abs(heading_error) < 1e-8);
+    assert(batch.pose() == single.pose());
+
+    std::cout << "  ✓ Odometry tests passed\n\n";
+}
+
+// Test planar arm kinematics: IK against exact forward kinematics,
+// reachability, both elbow solutions, three links and the batches
+void test_kinematics() {
+    std::cout << "Testing Kinematics...\n";
+
+    using Arm = Kinematics<Trig256>;
+    auto radians = [](Angle14 a) { return a.raw() * M_PI / 8192; };
+    uint32_t seed = 31;
+    auto next = [&] {
+        seed = seed * 1664525u + 1013904223u;
+        return (seed >> 8) / 16777216.0;
+    };
+
+    // Reachable targets at three scales, up to lengths whose squares
+    // overflow 32 bits; error relative to the reach
+    for (int scale : {1, 1000, 20000}) {
+        int64_t upper = 300 * scale, lower = 250 * scale;
+        for (auto elbow : {Arm::Elbow::Positive, Arm::Elbow::Negative}) {
+            Arm arm(int32_t(upper), int32_t(lower), 0, elbow);
+            double worst = 0;
+            for (int i = 0; i < 20000; ++i) {
+                double r = 50.0 * scale + 500.0 * scale * next(), a = 2 * M_PI * next();
+                Arm::Point target{int32_t(std::lround(r * std::cos(a))), int32_t(std::lround(r * std::sin(a)))};
+                if (!arm.reachable(target)) continue;
+                Arm::Joints j = arm.solve(target);
+                assert(elbow == Arm::Elbow::Positive ? j.elbow.raw() <= 8192
+                                                     : j.elbow.raw() == 0 || j.elbow.raw() >= 8192);
+                assert(j.wrist.raw() == 0);
+                double s = radians(j.shoulder), e = s + radians(j.elbow);
+                worst = std::max(worst, std::hypot(upper * std::cos(s) + lower * std::cos(e) - target.x,
+                                                   upper * std::sin(s) + lower * std::sin(e) - target.y));
+            }
+            double relative = worst / double(upper + lower);
+            std::cout << "  Links " << upper << "/" << lower << (elbow == Arm::Elbow::Positive ? " +" : " -")
+                      << ": worst " << relative * 100 << "% of reach\n";
+            assert(relative < 0.001);
+        }
+    }
+
+    // Reach limits, and targets out of reach stretch or fold the arm
+    Arm arm(300, 250);
+    assert(arm.reachable(Arm::Point{550, 0}) && arm.reachable(Arm::Point{0, -50}));
+    assert(!arm.reachable(Arm::Point{389, 389}) && !arm.reachable(Arm::Point{30, 30}));
+    assert(arm.solve(Arm::Point{550, 0}) == (Arm::Joints{Angle14{}, Angle14{}, Angle14{}}));
+    Arm::Joints stretched = arm.solve(Arm::Point{1000, 1000});
+    assert(stretched.shoulder.raw() == 2048 && stretched.elbow.raw() == 0);
+    Arm::Joints folded = arm.solve(Arm::Point{0, 10});
+    assert(folded.shoulder.raw() == 4096 && folded.elbow.raw() == 8192);
+
+    // Three links: the pose comes back through forward()
+    Arm hand_arm(3000, 2500, 800);
+    int worst_position = 0, worst_orientation = 0;
+    for (int i = 0; i < 20000; ++i) {
+        double r = 1000 + 5000 * next(), a = 2 * M_PI * next();
+        Arm::Pose target{{int32_t(std::lround(r * std::cos(a))), int32_t(std::lround(r * std::sin(a)))},
+                         Angle14::from_raw(static_cast<uint32_t>(next() * 16384))};
+        if (!hand_arm.reachable(target)) continue;
+        Arm::Pose reached = hand_arm.forward(hand_arm.solve(target));
+        worst_position = std::max({worst_position, std::abs(reached.position.x - target.position.x),
+                                   std::abs(reached.position.y - target.position.y)});
+        worst_orientation = std::max(worst_orientation, std::abs((reached.orientation - target.orientation).to_signed()));
+    }
+    std::cout << "  Three links 3000/2500/800: worst " << worst_position << " units, orientation "
+              << worst_orientation << "\n";
+    assert(worst_position <= 4 && worst_orientation == 0);
+
+    // Batches, including a partial block, match the single calls
+    const std::size_t count = 600;
+    std::vector<Arm::Point> points(count);
+    std::vector<Arm::Pose> poses(count);
+    for (std::size_t k = 0; k < count; ++k) {
+        double r = 7000 * next(), a = 2 * M_PI * next();
+        points[k] = {int32_t(std::lround(r * std::cos(a))), int32_t(std::lround(r * std::sin(a)))};
+        poses[k] = {points[k], Angle14::from_raw(static_cast<uint32_t>(k * 97))};
+    }
+    std::vector<Arm::Joints> joints(count), hand_joints(count);
+    std::vector<Arm::Pose> reached(count);
+    std::size_t unreachable = hand_arm.solve(std::span<const Arm::Point>(points), joints);
+    std::size_t hand_unreachable = hand_arm.solve(std::span<const Arm::Pose>(poses), hand_joints);
+    hand_arm.forward(hand_joints, reached);
+    std::size_t expected = 0, hand_expected = 0;
+    for (std::size_t k = 0; k < count; ++k) {
+        assert(joints[k] == hand_arm.solve(points[k]));
+        assert(hand_joints[k] == hand_arm.solve(poses[k]));
+        assert(reached[k] == hand_arm.forward(hand_joints[k]));
+        expected += !hand_arm.reachable(points[k]);
+        hand_expected += !hand_arm.reachable(poses[k]);
+    }
+    assert(unreachable == expected && hand_unreachable == hand_expected && expected > 0);
+
+    std::cout << "  ✓ Kinematics tests passed\n\n";
+}
+
+// Test the table-free polynomial backend
+void test_poly_trig() {
+    std::cout << "Testing PolyTrig (table-free)...\n";
+    
+    double sin3 = max_sine_error<PolyTrig<3>>();
+    double sin5 = max_sine_error<PolyTrig<5>>();
+    double sin7 = max_sine_error<PolyTrig<7>>();
+    double atan5 = atan2_max_error<PolyTrig<5>>();
+    double atan7 = atan2_max_error<PolyTrig<7>>();
+    std::cout << "  sin error (LSB):   deg3 " << sin3 << ", deg5 " << sin5 << ", deg7 " << sin7 << "\n";
+    std::cout << "  atan2 error (units): deg5 " << atan5 << ", deg7 " << atan7 << "\n";
+    assert(sin3 < 140.0 && sin5 < 3.5 && sin7 < 1.5);
+    assert(atan5 < 1.5 && atan7 < 1.0);
+    
+    static_assert(PolyTrig<5>::table_memory() == 0);
+    static_assert(PolyTrig<5>::sin(4096) == 16384 && PolyTrig<5>::sin(0) == 0);
+    static_assert(PolyTrig<7>::cos(8192) == -16384);
+    
+    // asin/acos through atan2 and an integer square root
+    double max_asin_error = 0;
+    for (int v = -16384; v <= 16384; ++v) {
+        double expected = std::asin(v / 16384.0) / (2.0 * M_PI) * 16384.0;
+        double diff = PolyTrig<5>::asin(static_cast<int16_t>(v)) - expected;
+        diff -= 16384.0 * std::round(diff / 16384.0);
+        max_asin_error = std::max(max_asin_error, std::abs(diff));
+    }
+    assert(max_asin_error < 1.5);
+    assert(PolyTrig<5>::asin(16384) == 4096);
+    assert(PolyTrig<5>::acos(16384) == 0);
+    
+    // Same API as IntegerTrig: batches are bit-exact, Vector2D works
+    std::vector<uint16_t> angles(65536 + 5);
+    for (std::size_t i = 0; i < angles.size(); ++i) {
+        angles[i] = static_cast<uint16_t>(i * 40503u);
+    }
+    bool ok = batch_matches_scalar<PolyTrig<3>>(angles) &&
+              batch_matches_scalar<PolyTrig<5>>(angles) &&
+              batch_matches_scalar<PolyTrig<7>>(angles);
+    assert(ok);
+    
+    using Vec = Vector2D<PolyTrig<5>>;
+    auto polar = Vec::to_polar({3000, -4000});
+    assert(std::abs(polar.magnitude - 5000) <= 5);
+    auto back = Vec::from_polar(polar);
+    assert(std::abs(back.x - 3000) <= 4 && std::abs(back.y + 4000) <= 4);
+    
+    auto wide = PolyTrig<5>::to_polar(-1000000000, 300000000);
+    double expected_angle = std::atan2(3e8, -1e9) / (2.0 * M_PI) * 16384.0;
+    assert(std::abs(wide.angle - expected_angle) < 1.5);
+    assert(std::abs(wide.magnitude - 1044030650.0) < 1044030650.0 * 1e-3);
+    
+    std::cout << "  ✓ PolyTrig tests passed\n\n";
+}
+
+// Test the phase-accumulator oscillator
+void test_oscillator() {
+    std::cout << "Testing oscillator (NCO)...\n";
+    
+    const uint32_t increment = Oscillator<Trig128>::increment_for(1000, 48000);
+    assert(increment == static_cast<uint32_t>((uint64_t(1000) << 32) / 48000));
+    assert(Oscillator<Trig128>::increment_for(0, 1) == 0);
+    assert(Oscillator<Trig128>::increment_for(47999, 48000) == static_cast<uint32_t>((uint64_t(47999) << 32) / 48000));
+    
+    // Block output matches per-sample output across uneven block sizes
+    Oscillator<Trig128> reference(increment, 0x12345678);
+    Oscillator<Trig128> block(increment, 0x12345678);
+    std::vector<int16_t> expected(1500);
+    for (auto& v : expected) v = reference.next();
+    
+    std::vector<int16_t> actual(expected.size());
+    std::size_t pos = 0;
+    for (std::size_t len : {1u, 7u, 256u, 300u, 513u, 423u}) {
+        block.fill(std::span<int16_t>(actual).subspan(pos, len));
+        pos += len;
+    }
+    assert(pos == actual.size());
+    assert(actual == expected);
+    assert(block.phase() == reference.phase());
+    
+    // Samples are the table sine of the top 14 phase bits
+    for (std::size_t k = 0; k < expected.size(); ++k) {
+        uint32_t phase = 0x12345678u + static_cast<uint32_t>(k) * increment;
+        assert(expected[k] == Trig128::sin(phase >> 18));
+    }
+    
+    // I/Q output is cos/sin of the same phase
+    Oscillator<Trig128> iq(increment);
+    std::vector<int16_t> i_out(1000), q_out(1000);
+    iq.fill_iq(i_out, q_out);
+    for (std::size_t k = 0; k < i_out.size(); ++k) {
+        uint32_t phase = static_cast<uint32_t>(k) * increment;
+        assert(i_out[k] == Trig128::cos(phase >> 18));
+        assert(q_out[k] == Trig128::sin(phase >> 18));
+    }
+    
+    // Frequency change is phase continuous
+    Oscillator<Trig128> sweep(increment);
+    std::vector<int16_t> first(100);
+    sweep.fill(first);
+    uint32_t phase_at_switch = sweep.phase();
+    assert(phase_at_switch == 100u * increment);
+    sweep.set_increment(2 * increment);
+    int16_t after = sweep.next();
+    assert(after == Trig128::sin(phase_at_switch >> 18));
+    assert(sweep.phase() == phase_at_switch + 2 * increment);
+    
+    std::cout << "  ✓ Oscillator tests passed\n\n";
+}
+
+void test_mixer() {
+    std::cout << "Testing quadrature mixer...\n";
+    
+    const uint32_t down = Mixer<Trig128>::increment_for(-12500, 100000);
+    assert(down == static_cast<uint32_t>(-(int64_t(12500) << 32) / 100000));
+    assert(Mixer<Trig128>::increment_for(1000, 48000) == Oscillator<Trig128>::increment_for(1000, 48000));
+    assert(Mixer<Trig128>::increment_for(-47999, 48000) == static_cast<uint32_t>(-(int64_t(47999) << 32) / 48000));
+    
+    // Input within the unit circle, plus full-scale samples that clip
+    std::vector<ComplexQ15> in(1500);
+    uint32_t seed = 3;
+    for (auto& z : in) {
+        seed = seed * 1664525u + 1013904223u;
+        z = {static_cast<int16_t>(int16_t(seed >> 16) * 23170 / 32768),
+             static_cast<int16_t>(int16_t(seed) * 23170 / 32768)};
+    }
+    in[100] = {32767, 32767};
+    in[101] = {-32768, -32768};
+    std::vector<int16_t> re(in.size()), im(in.size());
+    for (std::size_t k = 0; k < in.size(); ++k) {
+        re[k] = in[k].re;
+        im[k] = in[k].im;
+    }
+    
+    // Per-sample reference: rounded, saturated rotation by the table
+    // sincos of the top 14 phase bits
+    Mixer<Trig128> single(down, 0x12345678);
+    std::vector<ComplexQ15> expected(in.size()), expected_real(in.size());
+    for (std::size_t k = 0; k < in.size(); ++k) {
+        uint32_t phase = 0x12345678u + static_cast<uint32_t>(k) * down;
+        int16_t s, c;
+        Trig128::sincos(static_cast<uint16_t>(phase >> 18), s, c);
+        auto narrow = [](int32_t v) { return static_cast<int16_t>(std::clamp((v + 8192) >> 14, -32768, 32767)); };
+        expected[k] = {narrow(in[k].re * c - in[k].im * s), narrow(in[k].re * s + in[k].im * c)};
+        expected_real[k] = {narrow(in[k].re * c), narrow(in[k].re * s)};
+        assert(single.mix(in[k]) == expected[k]);
+    }
+    int clipped = 0;
+    for (const ComplexQ15& z : {expected[100], expected[101]}) {
+        clipped += (z.re == 32767 || z.re == -32768) + (z.im == 32767 || z.im == -32768);
+    }
+    assert(clipped > 0);
+    
+    // Blocks of uneven sizes continue the phase and match the single
+    // samples, for all three layouts
+    Mixer<Trig128> interleaved(down, 0x12345678), split(down, 0x12345678), real(down, 0x12345678);
+    std::vector<ComplexQ15> out(in.size());
+    std::vector<int16_t> i_out(in.size()), q_out(in.size()), i_real(in.size()), q_real(in.size());
+    std::size_t pos = 0;
+    for (std::size_t len : {1u, 7u, 256u, 300u, 513u, 423u}) {
+        interleaved.mix(std::span<const ComplexQ15>(in).subspan(pos, len), std::span(out).subspan(pos, len));
+        split.mix(std::span<const int16_t>(re).subspan(pos, len), std::span<const int16_t>(im).subspan(pos, len),
+                  std::span(i_out).subspan(pos, len), std::span(q_out).subspan(pos, len));
+        real.mix(std::span<const int16_t>(re).subspan(pos, len),
+                 std::span(i_real).subspan(pos, len), std::span(q_real).subspan(pos, len));
+        pos += len;
+    }
+    assert(pos == in.size());
+    assert(out == expected);
+    for (std::size_t k = 0; k < in.size(); ++k) {
+        assert(i_out[k] == expected[k].re && q_out[k] == expected[k].im);
+        assert(i_real[k] == expected_real[k].re && q_real[k] == expected_real[k].im);
+    }
+    assert(interleaved.phase() == single.phase());
+    assert(split.phase() == single.phase() && real.phase() == single.phase());
+    
+    // In place
+    Mixer<Trig128> in_place(down, 0x12345678);
+    std::vector<ComplexQ15> buffer = in;
+    in_place.mix(buffer, buffer);
+    assert(buffer == expected);
+    
+    // Close to the exact rotation by the 14-bit angle: each Q14 unit of
+    // table error is up to about 3 LSB on a full-scale Q15 sample
+    double worst = 0;
+    for (std::size_t k = 0; k < in.size(); ++k) {
+        if (k == 100 || k == 101) continue;
+        uint32_t phase = 0x12345678u + static_cast<uint32_t>(k) * down;
+        std::complex<double> exact = std::complex<double>(in[k].re, in[k].im) *
+                                     std::polar(1.0, (phase >> 18) * (2 * M_PI / 16384));
+        worst = std::max(worst, std::abs(std::complex<double>(out[k].re, out[k].im) - exact));
+    }
+    assert(worst < 6.0);
+    
+    // Mixing a tone down by its own frequency leaves a constant
+    const uint32_t tone = Oscillator<Trig128>::increment_for(12500, 100000);
+    Oscillator<Trig128> carrier(tone);
+    std::vector<int16_t> c_in(512), s_in(512), dc_i(512), dc_q(512);
+    carrier.fill_iq(c_in, s_in);
+    Mixer<Trig128> demod(Mixer<Trig128>::increment_for(-12500, 100000));
+    demod.mix(c_in, s_in, dc_i, dc_q);
+    for (std::size_t k = 0; k < dc_i.size(); ++k) {
+        assert(std::abs(dc_i[k] - 16384) <= 4 && std::abs(dc_q[k]) <= 16);
+    }
+    
+    std::cout << "  ✓ Mixer tests passed\n\n";
+}
+
+// Signal-to-error ratio (dB) of a block-floating-point spectrum against a
+// double-precision DFT of the same input
+template<std::size_t N>
+double fft_snr_db(const std::vector<std::complex<double>>& input,
+                  const ComplexQ15* spectrum, std::size_t bins, int exponent) {
+    double signal = 0, noise = 0;
+    for (std::size_t k = 0; k < bins; ++k) {
+        std::complex<double> ref = 0;
+        for (std::size_t n = 0; n < N; ++n) {
+            ref += input[n] * std::polar(1.0, -2.0 * M_PI * double(k * n % N) / N);
+        }
+        std::complex<double> got(std::ldexp(double(spectrum[k].re), exponent),
+                                 std::ldexp(double(spectrum[k].im), exponent));
+        signal += std::norm(ref);
+        noise += std::norm(got - ref);
+    }
+    return 10.0 * std::log10(signal / noise);
+}
+
+// Test the block-floating-point FFT against a double DFT
+void test_fft() {
+    std::cout << "Testing fixed-point FFT...\n";
+    
+    constexpr std::size_t N = 256;
+    using FFT256 = FFT<N, Trig128>;
+    
+    // Noise-like input spanning most of the Q15 range
+    uint32_t seed = 12345;
+    auto next_sample = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<int16_t>(static_cast<int32_t>(seed >> 16) - 32768);
+    };
+    
+    std::vector<ComplexQ15> data(N);
+    std::vector<std::complex<double>> input(N);
+    for (std::size_t n = 0; n < N; ++n) {
+        data[n] = {next_sample(), next_sample()};
+        input[n] = {double(data[n].re), double(data[n].im)};
+    }
+    
+    int exponent = FFT256::forward(std::span<ComplexQ15, N>(data));
+    double snr = fft_snr_db<N>(input, data.data(), N, exponent);
+    std::cout << "  Forward: exponent " << exponent << ", SNR " << snr << " dB\n";
+    assert(exponent >= 0 && exponent <= 9);
+    assert(snr > 55.0);
+    
+    // Round trip recovers the input scaled by 2^(forward + inverse)
+    int inverse_exponent = FFT256::inverse(std::span<ComplexQ15, N>(data));
+    double max_error = 0;
+    for (std::size_t n = 0; n < N; ++n) {
+        double re = std::ldexp(double(data[n].re), exponent + inverse_exponent);
+        double im = std::ldexp(double(data[n].im), exponent + inverse_exponent);
+        max_error = std::max({max_error, std::abs(re - input[n].real()),
+                              std::abs(im - input[n].imag())});
+    }
+    std::cout << "  Round trip max error: " << max_error << " LSB\n";
+    assert(max_error < 64.0);
+    
+    // Full-scale DC cannot overflow: one bin holding 32767 * N
+    std::vector<ComplexQ15> dc(N, ComplexQ15{32767, -32768});
+    exponent = FFT256::forward(std::span<ComplexQ15, N>(dc));
+    assert(std::abs(std::ldexp(double(dc[0].re), exponent) - 32767.0 * N) < 32767.0 * N * 1e-3);
+    assert(std::abs(std::ldexp(double(dc[0].im), exponent) + 32768.0 * N) < 32768.0 * N * 1e-3);
+    for (std::size_t k = 1; k < N; ++k) {
+        assert(std::abs(dc[k].re) <= 2 && std::abs(dc[k].im) <= 2);
+    }
+    
+    // A single tone lands in its bin
+    std::vector<ComplexQ15> tone(N);
+    for (std::size_t n = 0; n < N; ++n) {
+        int16_t s, c;
+        Trig128::sincos(static_cast<uint16_t>(n * 13 * (16384 / N)), s, c);
+        tone[n] = {c, s};
+    }
+    exponent = FFT256::forward(std::span<ComplexQ15, N>(tone));
+    assert(std::abs(std::ldexp(double(tone[13].re), exponent) - 16384.0 * N) < 16384.0 * N * 0.01);
+    
+    // Real-input transform matches the DFT of the real signal
+    std::vector<int16_t> real_in(N);
+    std::vector<std::complex<double>> real_ref(N);
+    for (std::size_t n = 0; n < N; ++n) {
+        real_in[n] = next_sample();
+        real_ref[n] = double(real_in[n]);
+    }
+    std::vector<ComplexQ15> half(N / 2 + 1);
+    exponent = FFT256::forward_real(std::span<const int16_t, N>(real_in),
+                                    std::span<ComplexQ15, N / 2 + 1>(half));
+    snr = fft_snr_db<N>(real_ref, half.data(), N / 2 + 1, exponent);
+    std::cout << "  Real forward: exponent " << exponent << ", SNR " << snr << " dB\n";
+    assert(snr > 55.0);
+    assert(half[0].im == 0 && half[N / 2].im == 0);
+    
+    // Batch transform is the same as one frame at a time
+    std::vector<ComplexQ15> frames(3 * N), single(N);
+    for (auto& v : frames) v = {next_sample(), next_sample()};
+    std::vector<int> exponents(3);
+    std::copy(frames.begin() + N, frames.begin() + 2 * N, single.begin());
+    FFT256::forward_batch(frames, exponents);
+    assert(exponents[1] == FFT256::forward(std::span<ComplexQ15, N>(single)));
+    assert(std::equal(single.begin(), single.end(), frames.begin() + N));
+    
+    // Larger transforms stay accurate
+    constexpr std::size_t L = 2048;
+    std::vector<ComplexQ15> large(L);
+    std::vector<std::complex<double>> large_in(L);
+    for (std::size_t n = 0; n < L; ++n) {
+        large[n] = {next_sample(), next_sample()};
+        large_in[n] = {double(large[n].re), double(large[n].im)};
+    }
+    exponent = FFT<L, Trig512>::forward(std::span<ComplexQ15, L>(large));
+    snr = fft_snr_db<L>(large_in, large.data(), L, exponent);
+    std::cout << "  2048-point: exponent " << exponent << ", SNR " << snr << " dB\n";
+    assert(snr > 50.0);
+    
+    std::cout << "  ✓ FFT tests passed\n\n";
+}
+
+// Test Goertzel and sliding-DFT bins against a double DFT
+void test_detectors() {
+    std::cout << "Testing Goertzel / sliding DFT...\n";
+    
+    // DTMF-style bank at 8 kHz: 697 Hz row, 1209 Hz column, 50 Hz mains
+    constexpr uint32_t fs = 8000;
+    using Bank = Goertzel<Trig128, 3>;
+    constexpr std::array<uint16_t, 3> steps = {
+        Bank::step_for(697, fs), Bank::step_for(1209, fs), Bank::step_for(50, fs)};
+    static_assert(steps[0] == 1427);  // 697 * 16384 / 8000 = 1427.46
+    
+    auto dft_at = [](const std::vector<int16_t>& x, uint16_t step) {
+        std::complex<double> sum = 0;
+        for (std::size_t n = 0; n < x.size(); ++n) {
+            sum += double(x[n]) * std::polar(1.0, -2.0 * M_PI * step * double(n) / 16384.0);
+        }
+        return sum;
+    };
+    
+    // 697 Hz + 50 Hz, 205-sample block (the usual DTMF block length)
+    std::vector<int16_t> signal(205);
+    for (std::size_t n = 0; n < signal.size(); ++n) {
+        signal[n] = static_cast<int16_t>(
+            (Trig128::sin(static_cast<uint16_t>(n * steps[0])) * 3) / 4 +
+            Trig128::sin(static_cast<uint16_t>(n * steps[2] + 1000)) / 4);
+    }
+    
+    Bank bank(steps);
+    bank.update(signal);
+    double max_rel_error = 0;
+    for (std::size_t b = 0; b < Bank::bins(); ++b) {
+        double expected = std::abs(dft_at(signal, steps[b]));
+        Complex32 r = bank.result(b);
+        double got = std::hypot(double(r.re), double(r.im));
+        max_rel_error = std::max(max_rel_error, std::abs(got - expected) / (expected + 1000.0));
+        double mag = bank.magnitude(b);
+        assert(std::abs(mag - got) <= got * 0.001 + 2);
+    }
+    std::cout << "  Goertzel max relative error: " << max_rel_error * 100 << "%\n";
+    assert(max_rel_error < 0.001);
+    assert(bank.magnitude(0) > 10 * bank.magnitude(1));
+    
+    bank.reset();
+    assert(bank.result(0) == (Complex32{0, 0}));
+    
+    // Sliding DFT matches the DFT of the current window after many updates
+    constexpr std::size_t W = 64;
+    SlidingDFT<W, Trig128, 2> sliding({3, 10});
+    uint32_t seed = 777;
+    std::vector<int16_t> history;
+    for (int n = 0; n < 5000; ++n) {
+        seed = seed * 1664525u + 1013904223u;
+        int16_t x = static_cast<int16_t>(static_cast<int32_t>(seed >> 16) - 32768);
+        history.push_back(x);
+        sliding.update(x);
+    }
+    
+    std::vector<int16_t> window(history.end() - W, history.end());
+    const uint16_t bins[2] = {3, 10};
+    for (std::size_t b = 0; b < 2; ++b) {
+        std::complex<double> expected = 0;
+        for (std::size_t m = 0; m < W; ++m) {
+            expected += double(window[m]) * std::polar(1.0, -2.0 * M_PI * double(bins[b] * m) / W);
+        }
+        Complex32 r = sliding.result(b);
+        assert(std::abs(std::complex<double>(r.re, r.im) - expected) < 32768.0 * W * 2e-4);
+        assert(std::abs(sliding.magnitude(b) - std::abs(expected)) < std::abs(expected) * 0.001 + 32.0);
+    }
+    
+    // Drift-free: once the window is all zeros the bins are exactly zero
+    for (std::size_t n = 0; n < W; ++n) {
+        sliding.update(int16_t(0));
+    }
+    assert(sliding.result(0) == (Complex32{0, 0}));
+    assert(sliding.result(1) == (Complex32{0, 0}));
+    
+    std::cout << "  ✓ Detector tests passed\n\n";
+}
+
 // Main test runner
 int main() {
     std::cout << "FastTrig Library Test Suite\n";
@@ -337,11 +2029,34 @@ int main() {
     try {
         test_accuracy();
         test_atan2();
+        test_atan2_policies();
         test_inverse();
         test_magnitude();
+        test_magnitude_batch();
+        test_to_polar();
         test_special_angles();
         test_table_sizes();
         test_sincos();
+        test_batch();
+        test_interpolation();
+        test_layout();
+        test_trig32();
+        test_poly_trig();
+        test_memory_minimal();
+        test_atan2_lut();
+        test_fixed();
+        test_angle();
+        test_rotor();
+        test_vector_batch();
+        test_rotation3d();
+        test_foc();
+        test_tracking_observer();
+        test_odometry();
+        test_kinematics();
+        test_oscillator();
+        test_mixer();
+        test_fft();
+        test_detectors();
         
         std::cout << "=============================\n";
         std::cout << "✓ All tests passed!\n";